@@ -1,6 +1,14 @@
 #include <stddef.h>
 typedef unsigned int uint32_t;
 
+#define CONSOLE_TX_CONTROL (*(volatile uint32_t*) 0xFFFF0008)
+#define CONSOLE_TX_DATA (*(volatile uint32_t*) 0xFFFF000C)
+
+// .data and .bss, filled and cleared by the ram initializer of mips_r2000
+// before the first instruction, start.s has no loops for them
+static uint32_t letter_base = 'A' - 10;
+static uint32_t swaps;
+
 bool sorted(uint32_t const *const array, const size_t size) {
     for(size_t i = 0; i < size - 1; i++) {
         if(array[i] > array[i+1]) {
@@ -17,13 +25,31 @@ void bubble_sort(uint32_t* array, const size_t size) {
                 const unsigned int temp = array[i];
                 array[i] = array[i+1];
                 array[i+1] = temp;
+                swaps++;
             }
         }
     }
 }
 
+void print_char(const uint32_t c) {
+    while((CONSOLE_TX_CONTROL & 0x1) == 0);
+    CONSOLE_TX_DATA = c;
+}
+
+void print_array(uint32_t const *const array, const size_t size) {
+    for(size_t i = 0; i < size; i++) {
+        const uint32_t nibble = array[i] & 0xF;
+        print_char(nibble < 10 ? '0' + nibble : letter_base + nibble);
+    }
+    print_char('\n');
+}
+
 int main(void) {
     uint32_t array[8] = { 0x2, 0x5, 0x1, 0xF, 0x7, 0x3, 0xA, 0x0 };
+    print_array(array, sizeof(array) / sizeof(*array));
     bubble_sort(array, sizeof(array) / sizeof(*array));
-    return 0;
+    print_array(array, sizeof(array) / sizeof(*array));
+    // one swap per inversion, E for the 14 of the array
+    print_array(&swaps, 1);
+    return sorted(array, sizeof(array) / sizeof(*array)) == false;
 }
\ No newline at end of file
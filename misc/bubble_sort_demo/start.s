@@ -2,6 +2,9 @@
     .globl _start
 _start:
     la    $sp, _stack
+# Assembled with -Wa,--defsym,HW_INIT=1 the loops are left out, the ram
+# initializer of mips_r2000 fills .data and clears .bss at reset instead.
+    .ifndef HW_INIT
     la    $t0, _sbss
     la    $t1, _ebss
 clear_bss_loop:
@@ -24,9 +27,10 @@ copy_data_loop:
     j     copy_data_loop
     nop
 copy_data_done:
+    .endif
 
     jal   main
-    nop
+    sw    $v0, %lo(_tohost)($zero)
 hang:
     b hang
     nop
\ No newline at end of file
@@ -0,0 +1,35 @@
+    .set noreorder
+    .section .reset,"ax"
+    .globl _start
+# rd = one odd-even transposition step over the bytes of rs, rt on the byte
+# sort accelerator, SPECIAL2 function 0x10 | function. Registers by number.
+    .macro byte_sort function, rd, rs, rt
+    .word (0x1c << 26) | (\rs << 21) | (\rt << 16) | (\rd << 11) | 0x10 | \function
+    .endm
+
+# Sorts the same bytes as software_sort.s with 8 transposition steps, an even
+# and an odd one per iteration, on the two words in $s0, $s1.
+_start:
+    lui   $t0, 0x5a03
+    ori   $t0, $t0, 0xf021
+    sw    $t0, 0x40($zero)
+    lui   $t0, 0x7703
+    ori   $t0, $t0, 0x9c10
+    sw    $t0, 0x44($zero)
+    lw    $s0, 0x40($zero)
+    lw    $s1, 0x44($zero)
+    addiu $t0, $zero, 4
+sort:
+    byte_sort 0, 18, 16, 17
+    byte_sort 2, 19, 16, 17
+    byte_sort 1, 16, 18, 19
+    addiu $t0, $t0, -1
+    bne   $t0, $zero, sort
+    byte_sort 3, 17, 18, 19
+    sw    $s0, 0x40($zero)
+    sw    $s1, 0x44($zero)
+sorted:
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
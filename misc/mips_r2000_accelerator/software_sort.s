@@ -0,0 +1,36 @@
+    .set noreorder
+    .section .reset,"ax"
+    .globl _start
+# Bubble sorts the unsigned bytes 0x5a, 0x03, 0xf0, 0x21, 0x77, 0x03, 0x9c,
+# 0x10 at 0x40 one compare and swap at a time.
+_start:
+    lui   $t0, 0x5a03
+    ori   $t0, $t0, 0xf021
+    sw    $t0, 0x40($zero)
+    lui   $t0, 0x7703
+    ori   $t0, $t0, 0x9c10
+    sw    $t0, 0x44($zero)
+    addiu $a1, $zero, 0x47
+outer:
+    addiu $a0, $zero, 0x40
+    addiu $t0, $zero, 0
+inner:
+    lbu   $v1, 0($a0)
+    lbu   $v0, 1($a0)
+    addiu $a0, $a0, 1
+    sltu  $t1, $v0, $v1
+    beq   $t1, $zero, next
+    nop
+    sb    $v0, -1($a0)
+    sb    $v1, 0($a0)
+    addiu $t0, $zero, 1
+next:
+    bne   $a0, $a1, inner
+    nop
+    bne   $t0, $zero, outer
+    nop
+sorted:
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
@@ -0,0 +1,28 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# Word, half word and byte stores and loads, each one has to land on the
+# right lanes of the AXI data bus.
+_start:
+    lui   $t0, 0x1234
+    ori   $t0, $t0, 0x5678
+    addiu $t1, $zero, 0xab
+    addiu $t2, $zero, -2
+    sw    $t0, 0($zero)
+    sb    $t1, 4($zero)
+    sh    $t2, 8($zero)
+    lb    $t3, 0($zero)
+    lh    $t4, 8($zero)
+    lhu   $t5, 0($zero)
+    lbu   $t6, 4($zero)
+    nop
+    nop
+    addu  $v0, $t3, $t5
+    addu  $v0, $v0, $t6
+    sw    $v0, 12($zero)
+    sw    $t4, 16($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
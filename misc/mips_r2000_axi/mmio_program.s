@@ -0,0 +1,27 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# A RAM load right before each memory mapped load, the AXI data master keeps
+# rdata of the RAM load after rvalid dropped and none of it may show up in
+# the core id, thread id or console ready.
+_start:
+    lui   $t0, 0x1234
+    ori   $t0, $t0, 0x5678
+    sw    $t0, 0($zero)
+    lw    $t1, 0($zero)
+    lw    $t2, -4($zero)
+    lw    $t3, 0($zero)
+    lw    $t4, -8($zero)
+    lw    $t5, 0($zero)
+    lui   $t7, 0xffff
+    lw    $t6, 8($t7)
+    nop
+    sw    $t1, 4($zero)
+    sw    $t2, 8($zero)
+    sw    $t4, 12($zero)
+    sw    $t6, 16($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
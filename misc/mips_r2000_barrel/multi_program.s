@@ -0,0 +1,75 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# Every hardware thread runs this image. The thread id selects one of four
+# independent kernels, each thread stores its result to 4 * id and exits.
+_start:
+    lw    $s0, -8($zero)
+    addiu $t0, $zero, 1
+    beq   $s0, $zero, sum
+    nop
+    beq   $s0, $t0, fibonacci
+    addiu $t0, $zero, 2
+    beq   $s0, $t0, popcount
+    nop
+    b     gcd
+    nop
+# 1 + 2 + ... + 100
+sum:
+    addiu $v0, $zero, 0
+    addiu $t1, $zero, 100
+sum_loop:
+    addu  $v0, $v0, $t1
+    addiu $t1, $t1, -1
+    bne   $t1, $zero, sum_loop
+    nop
+    b     done
+    nop
+# fib(24)
+fibonacci:
+    addiu $v0, $zero, 0
+    addiu $t2, $zero, 1
+    addiu $t1, $zero, 24
+fibonacci_loop:
+    addu  $t3, $v0, $t2
+    addu  $v0, $t2, $zero
+    addiu $t1, $t1, -1
+    bne   $t1, $zero, fibonacci_loop
+    addu  $t2, $t3, $zero
+    b     done
+    nop
+# popcount(0xdeadbeef)
+popcount:
+    lui   $t1, 0xdead
+    ori   $t1, $t1, 0xbeef
+    addiu $v0, $zero, 0
+popcount_loop:
+    andi  $t2, $t1, 1
+    addu  $v0, $v0, $t2
+    srl   $t1, $t1, 1
+    bne   $t1, $zero, popcount_loop
+    nop
+    b     done
+    nop
+# gcd(1071, 462)
+gcd:
+    addiu $v0, $zero, 1071
+    addiu $t1, $zero, 462
+gcd_loop:
+    beq   $v0, $t1, done
+    sltu  $t2, $v0, $t1
+    bne   $t2, $zero, gcd_less
+    nop
+    b     gcd_loop
+    subu  $v0, $v0, $t1
+gcd_less:
+    b     gcd_loop
+    subu  $t1, $t1, $v0
+done:
+    sll   $t0, $s0, 2
+    sw    $v0, 0($t0)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
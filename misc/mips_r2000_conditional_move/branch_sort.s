@@ -0,0 +1,45 @@
+    .set noreorder
+    .section .reset,"ax"
+    .globl _start
+# Bubble sorts 2, 5, 1, 15, 7, 3, 10, 0 at 0x40 the way a compiler does
+# without conditional moves, with a branch around every swap.
+_start:
+    addiu $t0, $zero, 2
+    sw    $t0, 0x40($zero)
+    addiu $t0, $zero, 5
+    sw    $t0, 0x44($zero)
+    addiu $t0, $zero, 1
+    sw    $t0, 0x48($zero)
+    addiu $t0, $zero, 15
+    sw    $t0, 0x4c($zero)
+    addiu $t0, $zero, 7
+    sw    $t0, 0x50($zero)
+    addiu $t0, $zero, 3
+    sw    $t0, 0x54($zero)
+    addiu $t0, $zero, 10
+    sw    $t0, 0x58($zero)
+    sw    $zero, 0x5c($zero)
+    addiu $a1, $zero, 0x5c
+outer:
+    addiu $a0, $zero, 0x40
+    addiu $t0, $zero, 0
+inner:
+    lw    $v1, 0($a0)
+    lw    $v0, 4($a0)
+    addiu $a0, $a0, 4
+    sltu  $t1, $v0, $v1
+    beq   $t1, $zero, next
+    nop
+    sw    $v0, -4($a0)
+    sw    $v1, 0($a0)
+    addiu $t0, $zero, 1
+next:
+    bne   $a0, $a1, inner
+    nop
+    bne   $t0, $zero, outer
+    nop
+sorted:
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
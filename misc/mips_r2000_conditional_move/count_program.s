@@ -0,0 +1,35 @@
+    .set noreorder
+    .set mips32
+    .section .reset,"ax"
+    .globl _start
+# clz and clo on a few edge values, then a movz and a movn right before an
+# instruction that reads their destination, the failed move must not be
+# forwarded.
+_start:
+    lui   $t0, 0x0001
+    clz   $t1, $t0
+    sw    $t1, 0($zero)
+    clz   $t1, $zero
+    sw    $t1, 4($zero)
+    addiu $t0, $zero, -1
+    clo   $t1, $t0
+    sw    $t1, 8($zero)
+    lui   $t0, 0xfff0
+    clo   $t1, $t0
+    sw    $t1, 12($zero)
+    clz   $t1, $t0
+    sw    $t1, 16($zero)
+    addiu $t2, $zero, 7
+    addiu $t3, $zero, 9
+    movz  $t2, $t3, $t3
+    addu  $t4, $t2, $zero
+    sw    $t4, 20($zero)
+    movn  $t2, $t3, $t3
+    addu  $t4, $t2, $zero
+    sw    $t4, 24($zero)
+    movz  $t2, $zero, $zero
+    sw    $t2, 28($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
@@ -0,0 +1,45 @@
+    .set noreorder
+    .set mips32
+    .section .reset,"ax"
+    .globl _start
+# Bubble sorts the same array without branching on the comparison. The
+# larger element of each pair moves on in a register and movn/movz pick the
+# smaller one to store.
+_start:
+    addiu $t0, $zero, 2
+    sw    $t0, 0x40($zero)
+    addiu $t0, $zero, 5
+    sw    $t0, 0x44($zero)
+    addiu $t0, $zero, 1
+    sw    $t0, 0x48($zero)
+    addiu $t0, $zero, 15
+    sw    $t0, 0x4c($zero)
+    addiu $t0, $zero, 7
+    sw    $t0, 0x50($zero)
+    addiu $t0, $zero, 3
+    sw    $t0, 0x54($zero)
+    addiu $t0, $zero, 10
+    sw    $t0, 0x58($zero)
+    sw    $zero, 0x5c($zero)
+    addiu $a1, $zero, 0x5c
+outer:
+    addiu $a0, $zero, 0x40
+    lw    $v1, 0($a0)
+    addiu $t0, $zero, 0
+inner:
+    lw    $v0, 4($a0)
+    addiu $a0, $a0, 4
+    sltu  $t1, $v0, $v1
+    or    $t2, $v1, $zero
+    movn  $t2, $v0, $t1
+    movz  $v1, $v0, $t1
+    or    $t0, $t0, $t1
+    bne   $a0, $a1, inner
+    sw    $t2, -4($a0)
+    bne   $t0, $zero, outer
+    sw    $v1, 0($a0)
+sorted:
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
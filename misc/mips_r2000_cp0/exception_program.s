@@ -0,0 +1,66 @@
+    .set noreorder
+    .set mips32
+    .section .reset,"ax"
+    .globl _start
+# Raises a syscall, a break, an add overflow, a misaligned load and a syscall
+# in a branch delay slot. The handler logs Cause and EPC of each one to RAM and
+# returns behind the faulting instruction, or behind the delay slot when
+# Cause.BD is set.
+_start:
+    j     main
+    nop
+
+    .org 0x80
+exception:
+    mfc0  $k0, $13
+    mfc0  $k1, $14
+    sw    $k0, 0($s1)
+    sw    $k1, 4($s1)
+    addiu $s1, $s1, 8
+    bgez  $k0, skip
+    addiu $k1, $k1, 4
+    addiu $k1, $k1, 4
+skip:
+    mtc0  $k1, $14
+    addiu $s0, $s0, 1
+    eret
+
+main:
+    addiu $s0, $zero, 0
+    addiu $s1, $zero, 0
+    addiu $t0, $zero, 0
+    syscall
+    addiu $t0, $zero, 1
+    break
+    lui   $t1, 0x7fff
+    ori   $t1, $t1, 0xffff
+    addiu $t2, $zero, 0x22
+    add   $t2, $t1, $t0
+    addu  $t3, $t1, $t0
+    addiu $t4, $zero, 2
+    addiu $t5, $zero, 0x55
+    lw    $t5, 0($t4)
+    nop
+    mfc0  $t6, $8
+    b     delay_slot
+    syscall
+delay_slot:
+    sw    $t0, 64($zero)
+    sw    $t2, 68($zero)
+    sw    $t3, 72($zero)
+    sw    $t5, 76($zero)
+    sw    $t6, 80($zero)
+    sw    $s0, 84($zero)
+    addiu $t0, $zero, 4
+    mtc0  $t0, $12
+    .set push
+    .set mips1
+    rfe
+    .set pop
+    mfc0  $t0, $12
+    nop
+    sw    $t0, 88($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
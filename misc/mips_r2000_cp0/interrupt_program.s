@@ -0,0 +1,65 @@
+    .set noreorder
+    .set mips32
+    .section .reset,"ax"
+    .globl _start
+# Waits for interrupt line 0 and then line 3 from the testbench, then raises
+# software interrupt 0 itself. Each vector logs EPC and Cause to RAM, counts
+# the interrupt in $s0 and returns with eret.
+_start:
+    j     main
+    nop
+
+    .org 0x80
+exception:
+    addiu $t0, $zero, 1
+    sw    $t0, -16($zero)
+    nop
+
+    .org 0x200
+software0:
+    mfc0  $k0, $13
+    mfc0  $k1, $14
+    sw    $k0, 16($zero)
+    sw    $k1, 20($zero)
+    mtc0  $zero, $13
+    addiu $s0, $s0, 1
+    eret
+
+    .org 0x240
+line0:
+    mfc0  $k0, $13
+    mfc0  $k1, $14
+    sw    $k0, 0($zero)
+    sw    $k1, 4($zero)
+    addiu $s0, $s0, 1
+    eret
+
+    .org 0x2a0
+line3:
+    mfc0  $k0, $13
+    mfc0  $k1, $14
+    sw    $k0, 8($zero)
+    sw    $k1, 12($zero)
+    addiu $s0, $s0, 1
+    eret
+
+main:
+    addiu $s0, $zero, 0
+    ori   $t0, $zero, 0x2501
+    mtc0  $t0, $12
+wait_line0:
+    beq   $s0, $zero, wait_line0
+    nop
+    addiu $t1, $zero, 1
+wait_line3:
+    beq   $s0, $t1, wait_line3
+    nop
+    addiu $t0, $zero, 0x100
+    mtc0  $t0, $13
+    addiu $t2, $zero, 0x55
+    sw    $t2, 24($zero)
+    sw    $s0, 28($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
@@ -0,0 +1,58 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# Copies 12 words from 0x00 to 0x40 and fills the 4 words at 0x30 with the DMA
+# engine. The core sums up 10..1 and stores the partial sums while the copy
+# runs, so both take turns on the RAM write port.
+_start:
+    addiu $t0, $zero, 0
+    lui   $t1, 0x0102
+    ori   $t1, $t1, 0x0304
+    addiu $t2, $zero, 48
+init:
+    sw    $t1, 0($t0)
+    addiu $t0, $t0, 4
+    bne   $t0, $t2, init
+    addu  $t1, $t1, $t1
+copy:
+    sw    $zero, -64($zero)
+    addiu $t0, $zero, 64
+    sw    $t0, -60($zero)
+    sw    $t2, -56($zero)
+    addiu $t0, $zero, 1
+    sw    $t0, -48($zero)
+    addiu $v0, $zero, 0
+    addiu $t3, $zero, 10
+sum:
+    addu  $v0, $v0, $t3
+    sw    $v0, 124($zero)
+    addiu $t3, $t3, -1
+    bne   $t3, $zero, sum
+    nop
+copy_wait:
+    lw    $t0, -48($zero)
+    nop
+    andi  $t0, $t0, 1
+    bne   $t0, $zero, copy_wait
+    nop
+fill:
+    addiu $t0, $zero, 48
+    sw    $t0, -60($zero)
+    addiu $t0, $zero, 16
+    sw    $t0, -56($zero)
+    lui   $t0, 0xa5a5
+    ori   $t0, $t0, 0xa5a5
+    sw    $t0, -52($zero)
+    addiu $t0, $zero, 3
+    sw    $t0, -48($zero)
+fill_wait:
+    lw    $t0, -48($zero)
+    nop
+    andi  $t0, $t0, 1
+    bne   $t0, $zero, fill_wait
+    nop
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
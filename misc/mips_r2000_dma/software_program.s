@@ -0,0 +1,47 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# The same work as dma_program.s with the copy and the fill done by
+# load/store loops, as the baseline for the DMA engine.
+_start:
+    addiu $t0, $zero, 0
+    lui   $t1, 0x0102
+    ori   $t1, $t1, 0x0304
+    addiu $t2, $zero, 48
+init:
+    sw    $t1, 0($t0)
+    addiu $t0, $t0, 4
+    bne   $t0, $t2, init
+    addu  $t1, $t1, $t1
+copy:
+    addiu $t0, $zero, 0
+    addiu $t3, $zero, 64
+copy_loop:
+    lw    $t4, 0($t0)
+    addiu $t0, $t0, 4
+    sw    $t4, 0($t3)
+    bne   $t0, $t2, copy_loop
+    addiu $t3, $t3, 4
+    addiu $v0, $zero, 0
+    addiu $t3, $zero, 10
+sum:
+    addu  $v0, $v0, $t3
+    sw    $v0, 124($zero)
+    addiu $t3, $t3, -1
+    bne   $t3, $zero, sum
+    nop
+fill:
+    addiu $t0, $zero, 48
+    addiu $t3, $zero, 64
+    lui   $t1, 0xa5a5
+    ori   $t1, $t1, 0xa5a5
+fill_loop:
+    sw    $t1, 0($t0)
+    addiu $t0, $t0, 4
+    bne   $t0, $t3, fill_loop
+    nop
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
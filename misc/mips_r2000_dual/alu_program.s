@@ -0,0 +1,30 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# Two independent accumulator chains per iteration, so every adjacent pair of
+# ALU instructions in the loop body can issue together.
+_start:
+    addiu $t0, $zero, 100
+    addiu $v0, $zero, 0
+    addiu $v1, $zero, 0
+    addiu $t1, $zero, 0
+    addiu $t2, $zero, 0
+loop:
+    addu  $v0, $v0, $t0
+    xor   $v1, $v1, $t0
+    sll   $t3, $t0, 1
+    addiu $t4, $t0, 3
+    addu  $t1, $t1, $t3
+    addu  $t2, $t2, $t4
+    addiu $t0, $t0, -1
+    bne   $t0, $zero, loop
+    nop
+    sw    $v0, 0($zero)
+    sw    $v1, 4($zero)
+    sw    $t1, 8($zero)
+    sw    $t2, 12($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
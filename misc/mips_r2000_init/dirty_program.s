@@ -0,0 +1,19 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# Leaves all ones in the whole RAM, so a later run only sees initialized .data
+# and .bss if the initializer wrote them.
+_start:
+    addiu $t0, $zero, 0
+    addiu $t1, $zero, 128
+    addiu $t2, $zero, -1
+dirty:
+    sw    $t2, 0($t0)
+    addiu $t0, $t0, 4
+    bne   $t0, $t1, dirty
+    nop
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
@@ -0,0 +1,35 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# Has neither a .data copy nor a .bss clear loop, the initializer in
+# mips_r2000 fills both before the first instruction. Sums up .data into 0x60
+# and ORs all of .bss into 0x64.
+_start:
+    lui   $t0, 0x8000
+    addiu $t1, $t0, 32
+    addiu $v0, $zero, 0
+sum:
+    lw    $t2, 0($t0)
+    addiu $t0, $t0, 4
+    bne   $t0, $t1, sum
+    addu  $v0, $v0, $t2
+    addiu $t1, $t0, 64
+    addiu $v1, $zero, 0
+bss:
+    lw    $t2, 0($t0)
+    addiu $t0, $t0, 4
+    bne   $t0, $t1, bss
+    or    $v1, $v1, $t2
+    sw    $v0, 0($t0)
+    sw    $v1, 4($t0)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
+
+    .data
+    .word 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80
+
+    .bss
+    .space 64
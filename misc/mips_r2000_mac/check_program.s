@@ -0,0 +1,49 @@
+    .set noreorder
+    .set mips32
+    .section .reset,"ax"
+    .globl _start
+# Signed and unsigned products into HI/LO, accumulation in both directions
+# and mflo/mfhi right behind the instruction that wrote HI/LO.
+_start:
+    addiu $t0, $zero, -7
+    addiu $t1, $zero, 6
+    mult  $t0, $t1
+    mflo  $t2
+    mfhi  $t3
+    sw    $t2, 0($zero)
+    sw    $t3, 4($zero)
+    multu $t0, $t1
+    mfhi  $t3
+    sw    $t3, 8($zero)
+    madd  $t1, $t1
+    madd  $t1, $t1
+    mflo  $t2
+    sw    $t2, 12($zero)
+    msub  $t0, $t1
+    mflo  $t2
+    mfhi  $t3
+    sw    $t2, 16($zero)
+    sw    $t3, 20($zero)
+    lui   $t4, 0x8000
+    mtlo  $zero
+    mthi  $zero
+    maddu $t4, $t4
+    maddu $t4, $t4
+    mfhi  $t3
+    sw    $t3, 24($zero)
+    msubu $t4, $t4
+    mfhi  $t3
+    mflo  $t2
+    sw    $t3, 28($zero)
+    sw    $t2, 32($zero)
+    addiu $t5, $zero, 0x55
+    mthi  $t5
+    mtlo  $t1
+    mfhi  $t3
+    mflo  $t2
+    sw    $t3, 36($zero)
+    sw    $t2, 40($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
@@ -0,0 +1,81 @@
+    .set noreorder
+    .set mips32
+    .section .reset,"ax"
+    .globl _start
+# The same dot product and FIR as software_program.s with madd accumulating
+# in HI/LO, one madd per tap right behind the loads of its operands.
+_start:
+    addiu $t0, $zero, 3
+    sw    $t0, 0x40($zero)
+    addiu $t0, $zero, -1
+    sw    $t0, 0x44($zero)
+    addiu $t0, $zero, 4
+    sw    $t0, 0x48($zero)
+    addiu $t0, $zero, 1
+    sw    $t0, 0x4c($zero)
+    addiu $t0, $zero, -5
+    sw    $t0, 0x50($zero)
+    addiu $t0, $zero, 9
+    sw    $t0, 0x54($zero)
+    addiu $t0, $zero, 2
+    sw    $t0, 0x58($zero)
+    addiu $t0, $zero, -6
+    sw    $t0, 0x5c($zero)
+    addiu $t0, $zero, 2
+    sw    $t0, 0x60($zero)
+    addiu $t0, $zero, -3
+    sw    $t0, 0x64($zero)
+    addiu $t0, $zero, 5
+    sw    $t0, 0x68($zero)
+    addiu $t0, $zero, 1
+    sw    $t0, 0x6c($zero)
+    addiu $t0, $zero, 7
+    sw    $t0, 0x70($zero)
+    addiu $t0, $zero, -2
+    sw    $t0, 0x74($zero)
+    addiu $t0, $zero, 4
+    sw    $t0, 0x78($zero)
+    addiu $t0, $zero, 3
+    sw    $t0, 0x7c($zero)
+dot_start:
+    addiu $s0, $zero, 0x40
+    addiu $s1, $zero, 0x60
+    addiu $s2, $zero, 0x60
+    mtlo  $zero
+    mthi  $zero
+dot:
+    lw    $a0, 0($s1)
+    lw    $a1, 0($s0)
+    addiu $s0, $s0, 4
+    madd  $a0, $a1
+    bne   $s0, $s2, dot
+    addiu $s1, $s1, 4
+    mflo  $s3
+    sw    $s3, 0x20($zero)
+fir_start:
+    addiu $s0, $zero, 0x4c
+    addiu $s4, $zero, 0x60
+    addiu $s5, $zero, 0
+    addiu $s7, $zero, 0x70
+fir:
+    mtlo  $zero
+    mthi  $zero
+    addiu $s1, $zero, 0x60
+    or    $s6, $s0, $zero
+tap:
+    lw    $a0, 0($s1)
+    lw    $a1, 0($s6)
+    addiu $s1, $s1, 4
+    madd  $a0, $a1
+    bne   $s1, $s7, tap
+    addiu $s6, $s6, -4
+    mflo  $s3
+    sw    $s3, 0($s5)
+    addiu $s0, $s0, 4
+    bne   $s0, $s4, fir
+    addiu $s5, $s5, 4
+done:
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
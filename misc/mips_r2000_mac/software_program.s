@@ -0,0 +1,93 @@
+    .set noreorder
+    .section .reset,"ax"
+    .globl _start
+# The dot product of x at 0x40 and h at 0x60, eight words each, into 0x20,
+# then a 4 tap FIR of x with the first four words of h into 0x00-0x10.
+# Every product goes through a shift and add multiply.
+_start:
+    addiu $t0, $zero, 3
+    sw    $t0, 0x40($zero)
+    addiu $t0, $zero, -1
+    sw    $t0, 0x44($zero)
+    addiu $t0, $zero, 4
+    sw    $t0, 0x48($zero)
+    addiu $t0, $zero, 1
+    sw    $t0, 0x4c($zero)
+    addiu $t0, $zero, -5
+    sw    $t0, 0x50($zero)
+    addiu $t0, $zero, 9
+    sw    $t0, 0x54($zero)
+    addiu $t0, $zero, 2
+    sw    $t0, 0x58($zero)
+    addiu $t0, $zero, -6
+    sw    $t0, 0x5c($zero)
+    addiu $t0, $zero, 2
+    sw    $t0, 0x60($zero)
+    addiu $t0, $zero, -3
+    sw    $t0, 0x64($zero)
+    addiu $t0, $zero, 5
+    sw    $t0, 0x68($zero)
+    addiu $t0, $zero, 1
+    sw    $t0, 0x6c($zero)
+    addiu $t0, $zero, 7
+    sw    $t0, 0x70($zero)
+    addiu $t0, $zero, -2
+    sw    $t0, 0x74($zero)
+    addiu $t0, $zero, 4
+    sw    $t0, 0x78($zero)
+    addiu $t0, $zero, 3
+    sw    $t0, 0x7c($zero)
+dot_start:
+    addiu $s0, $zero, 0x40
+    addiu $s1, $zero, 0x60
+    addiu $s2, $zero, 0x60
+    addiu $s3, $zero, 0
+dot:
+    lw    $a0, 0($s1)
+    lw    $a1, 0($s0)
+    jal   multiply
+    addiu $s0, $s0, 4
+    addu  $s3, $s3, $v0
+    bne   $s0, $s2, dot
+    addiu $s1, $s1, 4
+    sw    $s3, 0x20($zero)
+fir_start:
+    addiu $s0, $zero, 0x4c
+    addiu $s4, $zero, 0x60
+    addiu $s5, $zero, 0
+    addiu $s7, $zero, 0x70
+fir:
+    addiu $s3, $zero, 0
+    addiu $s1, $zero, 0x60
+    or    $s6, $s0, $zero
+tap:
+    lw    $a0, 0($s1)
+    lw    $a1, 0($s6)
+    jal   multiply
+    addiu $s1, $s1, 4
+    addu  $s3, $s3, $v0
+    bne   $s1, $s7, tap
+    addiu $s6, $s6, -4
+    sw    $s3, 0($s5)
+    addiu $s0, $s0, 4
+    bne   $s0, $s4, fir
+    addiu $s5, $s5, 4
+done:
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
+
+# v0 = a0 * a1, one shift and add per bit of a1
+multiply:
+    addiu $v0, $zero, 0
+multiply_loop:
+    andi  $t9, $a1, 1
+    beq   $t9, $zero, multiply_skip
+    srl   $a1, $a1, 1
+    addu  $v0, $v0, $a0
+multiply_skip:
+    bne   $a1, $zero, multiply_loop
+    sll   $a0, $a0, 1
+    jr    $ra
+    nop
@@ -0,0 +1,103 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# Every core runs this image. Each core sorts its half of the array at 0x00,
+# both meet at an ll/sc barrier and core 0 merges the halves into 0x20.
+_start:
+    lw    $s0, -4($zero)
+    nop
+    bne   $s0, $zero, init_1
+    nop
+    sw    $zero, 64($zero)
+    addiu $t0, $zero, 0x2
+    sw    $t0, 0($zero)
+    addiu $t0, $zero, 0x5
+    sw    $t0, 4($zero)
+    addiu $t0, $zero, 0x1
+    sw    $t0, 8($zero)
+    addiu $t0, $zero, 0xF
+    sw    $t0, 12($zero)
+    b     sort
+    nop
+init_1:
+    addiu $t0, $zero, 0x7
+    sw    $t0, 16($zero)
+    addiu $t0, $zero, 0x3
+    sw    $t0, 20($zero)
+    addiu $t0, $zero, 0xA
+    sw    $t0, 24($zero)
+    addiu $t0, $zero, 0x0
+    sw    $t0, 28($zero)
+sort:
+    sll   $s1, $s0, 4
+    addiu $t1, $zero, 3
+sort_pass:
+    or    $t2, $s1, $zero
+    addiu $t3, $zero, 3
+sort_compare:
+    lw    $t4, 0($t2)
+    lw    $t5, 4($t2)
+    nop
+    sltu  $t6, $t5, $t4
+    beq   $t6, $zero, sort_next
+    nop
+    sw    $t5, 0($t2)
+    sw    $t4, 4($t2)
+sort_next:
+    addiu $t3, $t3, -1
+    bne   $t3, $zero, sort_compare
+    addiu $t2, $t2, 4
+    addiu $t1, $t1, -1
+    bne   $t1, $zero, sort_pass
+    nop
+barrier:
+    ll    $t0, 64($zero)
+    nop
+    addiu $t0, $t0, 1
+    sc    $t0, 64($zero)
+    nop
+    beq   $t0, $zero, barrier
+    nop
+    bne   $s0, $zero, exit
+    nop
+barrier_wait:
+    lw    $t0, 64($zero)
+    addiu $t1, $zero, 2
+    bne   $t0, $t1, barrier_wait
+    nop
+    addiu $t0, $zero, 0
+    addiu $t1, $zero, 16
+    addiu $t2, $zero, 32
+merge:
+    addiu $t7, $zero, 16
+    beq   $t0, $t7, merge_right
+    addiu $t7, $zero, 32
+    beq   $t1, $t7, merge_left
+    nop
+    lw    $t4, 0($t0)
+    lw    $t5, 0($t1)
+    nop
+    sltu  $t6, $t5, $t4
+    bne   $t6, $zero, merge_right
+    nop
+merge_left:
+    lw    $t4, 0($t0)
+    addiu $t0, $t0, 4
+    sw    $t4, 0($t2)
+    b     merge_next
+    nop
+merge_right:
+    lw    $t5, 0($t1)
+    addiu $t1, $t1, 4
+    sw    $t5, 0($t2)
+merge_next:
+    addiu $t2, $t2, 4
+    addiu $t7, $zero, 64
+    bne   $t2, $t7, merge
+    nop
+exit:
+    sw    $zero, -16($zero)
+hang:
+    b     hang
+    nop
@@ -0,0 +1,27 @@
+    .set noreorder
+    .set mips2
+    .section .reset,"ax"
+    .globl _start
+# A countdown loop closed by an unconditional branch, only the exit branch
+# has to wait for EX.
+_start:
+    addiu $t0, $zero, 100
+    addiu $v0, $zero, 0
+loop:
+    beq   $t0, $zero, done
+    nop
+    addu  $v0, $v0, $t0
+    b     loop
+    addiu $t0, $t0, -1
+done:
+    sw    $v0, 0($zero)
+    jal   finish
+    nop
+    b     halt
+    nop
+finish:
+    sw    $ra, 4($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
@@ -0,0 +1,63 @@
+    .set noreorder
+    .section .reset,"ax"
+    .globl _start
+# Fills an array through kuseg and reads it back through kseg0 while storing
+# ahead through kseg1, the stores have to reach the words the prefetcher
+# already buffered. Then sums the array through kseg0 and kseg1, only the
+# first one is prefetched.
+_start:
+    addiu $t0, $zero, 0x40
+    addiu $t2, $zero, 1
+init:
+    sw    $t2, 0($t0)
+    addiu $t0, $t0, 4
+    addiu $t2, $t2, 1
+    sltiu $t3, $t2, 9
+    bne   $t3, $zero, init
+    nop
+    lui   $t0, 0x8000
+    ori   $t0, $t0, 0x40
+    lui   $t1, 0xa000
+    ori   $t1, $t1, 0x44
+    addiu $t2, $zero, 6
+    addiu $t4, $zero, 0x100
+    addiu $v0, $zero, 0
+alias:
+    lw    $t3, 0($t0)
+    sw    $t4, 0($t1)
+    addiu $t0, $t0, 4
+    addu  $v0, $v0, $t3
+    addiu $t1, $t1, 4
+    addiu $t2, $t2, -1
+    bne   $t2, $zero, alias
+    nop
+alias_done:
+    sw    $v0, 0($zero)
+    lui   $t0, 0x8000
+    ori   $t0, $t0, 0x40
+    addiu $t2, $zero, 8
+    addiu $v0, $zero, 0
+cached:
+    lw    $t3, 0($t0)
+    addiu $t0, $t0, 4
+    addiu $t2, $t2, -1
+    bne   $t2, $zero, cached
+    addu  $v0, $v0, $t3
+cached_done:
+    sw    $v0, 4($zero)
+    lui   $t0, 0xa000
+    ori   $t0, $t0, 0x40
+    addiu $t2, $zero, 8
+    addiu $v0, $zero, 0
+uncached:
+    lw    $t3, 0($t0)
+    addiu $t0, $t0, 4
+    addiu $t2, $t2, -1
+    bne   $t2, $zero, uncached
+    addu  $v0, $v0, $t3
+uncached_done:
+    sw    $v0, 8($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
@@ -0,0 +1,60 @@
+    .set noreorder
+    .set mips32
+    .section .reset,"ax"
+    .globl _start
+# Times a countdown loop with the cycle timer, then arms the compare register
+# 100 cycles ahead and waits for the timer interrupt. The vector logs the
+# count it entered at and disarms the timer by writing compare.
+_start:
+    j     main
+    nop
+
+    .org 0x80
+exception:
+    addiu $t0, $zero, 1
+    sw    $t0, -16($zero)
+    nop
+
+    .org 0x2e0
+timer:
+    lw    $k0, -32($zero)
+    lw    $k1, -28($zero)
+    sw    $k0, 16($zero)
+    sw    $k1, 20($zero)
+    addiu $k0, $zero, -1
+    sw    $k0, -20($zero)
+    addiu $s0, $s0, 1
+    eret
+
+main:
+    lw    $t0, -32($zero)
+    lw    $t1, -28($zero)
+    addiu $t2, $zero, 10
+loop:
+    addiu $t2, $t2, -1
+    bne   $t2, $zero, loop
+    nop
+    lw    $t3, -32($zero)
+    lw    $t4, -28($zero)
+    subu  $t5, $t3, $t0
+    sw    $t0, 0($zero)
+    sw    $t3, 4($zero)
+    sw    $t5, 8($zero)
+    sw    $t4, 12($zero)
+    lw    $t0, -32($zero)
+    nop
+    addiu $t0, $t0, 100
+    sw    $zero, -20($zero)
+    sw    $t0, -24($zero)
+    sw    $t0, 24($zero)
+    addiu $s0, $zero, 0
+    ori   $t1, $zero, 0x8001
+    mtc0  $t1, $12
+wait:
+    beq   $s0, $zero, wait
+    nop
+    sw    $s0, 28($zero)
+    sw    $zero, -16($zero)
+halt:
+    b     halt
+    nop
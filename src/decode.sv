@@ -27,11 +27,110 @@ package Decode;
         ALUMode_SRL = $bits(logic [5-1:0])'(5'b0_0110),
         ALUMode_SRA = $bits(logic [5-1:0])'(5'b0_0111),
         ALUMode_SLT = $bits(logic [5-1:0])'(5'b1_1010),
-        ALUMode_SLTU = $bits(logic [5-1:0])'(5'b1_1011)
+        ALUMode_SLTU = $bits(logic [5-1:0])'(5'b1_1011),
+        ALUMode_CLZ = $bits(logic [5-1:0])'(5'b0_1000),
+        ALUMode_CLO = $bits(logic [5-1:0])'(5'b0_1001),
+        ALUMode_MOVZ = $bits(logic [5-1:0])'(5'b0_1010),
+        ALUMode_MOVN = $bits(logic [5-1:0])'(5'b0_1011)
     } ALUMode;
+
+    typedef struct packed {
+        logic ADD ;
+        logic SUB ;
+        logic AND ;
+        logic OR  ;
+        logic XOR ;
+        logic NOR ;
+        logic SLL ;
+        logic SRL ;
+        logic SRA ;
+        logic SLT ;
+        logic SLTU;
+        logic CLZ ;
+        logic CLO ;
+        logic MOVZ;
+        logic MOVN;
+        logic LINK;
+        logic LUI ;
+    } ALUSelect;
+
+    typedef struct packed {
+        logic LT;
+        logic GE;
+        logic EQ;
+        logic NE;
+        logic LE;
+        logic GT;
+    } BranchSelect;
+
+    typedef struct packed {
+        logic         MFC0    ;
+        logic         MTC0    ;
+        logic         RFE     ;
+        logic         ERET    ;
+        logic         SYSCALL ;
+        logic         BREAK   ;
+        logic [5-1:0] REGISTER;
+    } Cop0Select;
+
+    typedef struct packed {
+        logic MULT    ;
+        logic MADD    ;
+        logic MSUB    ;
+        logic UNSIGNED;
+        logic MFHI    ;
+        logic MFLO    ;
+        logic MTHI    ;
+        logic MTLO    ;
+    } MacSelect;
+
+    typedef struct packed {
+        logic         CUSTOM  ;
+        logic [4-1:0] FUNCTION;
+    } CustomSelect;
+
+    // Everything decode hands to EX besides the register data, registered as
+    // one word. The encoded ALU and branch modes are not carried, the selects
+    // already hold them.
+    typedef struct packed {
+        logic                                 RS                       ;
+        logic [Constants::REG_ADDR_WIDTH-1:0] RS_ADDRESS               ;
+        logic                                 RT                       ;
+        logic [Constants::REG_ADDR_WIDTH-1:0] RT_ADDRESS               ;
+        logic                                 RD                       ;
+        logic [Constants::REG_ADDR_WIDTH-1:0] RD_ADDRESS               ;
+        logic                                 SHAMT                    ;
+        logic [Constants::SHAMT_WIDTH-1:0]    SHAMT_VALUE              ;
+        logic                                 IMM                      ;
+        logic [Constants::IMM_WIDTH-1:0]      IMM_VALUE                ;
+        logic                                 TARGET                   ;
+        logic [Constants::TARGET_WIDTH-1:0]   TARGET_VALUE             ;
+        logic                                 ALU_MODE                 ;
+        logic                                 LINK                     ;
+        logic                                 BRANCH                   ;
+        logic                                 JUMP                     ;
+        logic                                 LOAD                     ;
+        logic                                 LOAD_SIGN_EXTEND         ;
+        logic [2-1:0]                         LOAD_STORE_DATA_SIZE_MODE;
+        logic                                 STORE                    ;
+        logic                                 LOAD_LINKED              ;
+        logic                                 STORE_CONDITIONAL        ;
+        logic                                 TRAP                     ;
+        ALUSelect                             ALU_SELECT               ;
+        BranchSelect                          BRANCH_SELECT            ;
+        Cop0Select                            COP0_SELECT              ;
+        MacSelect                             MAC_SELECT               ;
+        CustomSelect                          CUSTOM_SELECT            ;
+    } Control;
 endpackage
 
-module parser (
+// Instructions of a feature that is not built decode like any other unknown
+// instruction, as a no-op.
+module parser #(
+    parameter bit CP0                 = 0,
+    parameter bit MULTIPLY_ACCUMULATE = 0,
+    parameter bit ACCELERATOR         = 0
+) (
     input var logic [Constants::WIDTH-1:0] instruction,
 
     output var logic                                 rs        ,
@@ -60,7 +159,13 @@ module parser (
     output var logic         load                     ,
     output var logic         load_sign_extend         ,
     output var logic [2-1:0] load_store_data_size_mode,
-    output var logic         store                
+    output var logic         store                    ,
+    output var logic         load_linked              ,
+    output var logic         store_conditional        ,
+
+    output var Decode::Cop0Select   cop0_select  ,
+    output var Decode::MacSelect    mac_select   ,
+    output var Decode::CustomSelect custom_select
 );
     always_comb begin
 
@@ -91,6 +196,12 @@ module parser (
         load_sign_extend          = 0;
         load_store_data_size_mode = 0;
         store                     = 0;
+        load_linked               = 0;
+        store_conditional         = 0;
+
+        cop0_select   = 0;
+        mac_select    = 0;
+        custom_select = 0;
 
         if (instruction[31:27] == 5'b00001) begin
             // j target, jal target
@@ -175,6 +286,105 @@ module parser (
                     alu_mode       = 1;
                     alu_mode_value = {instruction[5], instruction[3:0]};
                 end
+                if (instruction[5:1] == 5'b00101) begin
+                    // Conditional Move Operations
+                    rs             = 1;
+                    rs_address     = instruction[25:21];
+                    rt             = 1;
+                    rt_address     = instruction[20:16];
+                    rd             = 1;
+                    rd_address     = instruction[15:11];
+                    alu_mode       = 1;
+                    alu_mode_value = {instruction[5], instruction[3:0]};
+                end
+            end
+            if (MULTIPLY_ACCUMULATE && (instruction[10:6] == 5'b00000) && (instruction[5:2] == 4'b0100)) begin
+                if (instruction[0] == 0) begin
+                    // mfhi rd, mflo rd, HI or LO is written back like an ALU result
+                    rd             = 1;
+                    rd_address     = instruction[15:11];
+                    alu_mode       = 1;
+                    alu_mode_value = Decode::ALUMode_ADDU;
+                end else begin
+                    // mthi rs, mtlo rs
+                    rs         = 1;
+                    rs_address = instruction[25:21];
+                end
+                mac_select.MFHI = (instruction[1:0] == 2'b00);
+                mac_select.MTHI = (instruction[1:0] == 2'b01);
+                mac_select.MFLO = (instruction[1:0] == 2'b10);
+                mac_select.MTLO = (instruction[1:0] == 2'b11);
+            end
+            if (MULTIPLY_ACCUMULATE && (instruction[15:6] == 10'b0) && (instruction[5:1] == 5'b01100)) begin
+                // mult rs, rt, multu rs, rt
+                rs                  = 1;
+                rs_address          = instruction[25:21];
+                rt                  = 1;
+                rt_address          = instruction[20:16];
+                mac_select.MULT     = 1;
+                mac_select.UNSIGNED = instruction[0];
+            end
+            if (CP0 && (instruction[5:1] == 5'b00110)) begin
+                // syscall, break
+                cop0_select.SYSCALL = !instruction[0];
+                cop0_select.BREAK   = instruction[0];
+            end
+        end
+        if (instruction[31:26] == 6'b011100) begin
+            if ((instruction[10:6] == 5'b00000) && (instruction[5:1] == 5'b10000)) begin
+                // clz rd, rs, clo rd, rs
+                rs             = 1;
+                rs_address     = instruction[25:21];
+                rd             = 1;
+                rd_address     = instruction[15:11];
+                alu_mode       = 1;
+                alu_mode_value = instruction[0] ? Decode::ALUMode_CLO : Decode::ALUMode_CLZ;
+            end
+            if (MULTIPLY_ACCUMULATE && (instruction[15:6] == 10'b0) && (instruction[5:3] == 3'b000) && (instruction[1] == 0)) begin
+                // madd rs, rt, maddu rs, rt, msub rs, rt, msubu rs, rt
+                rs                  = 1;
+                rs_address          = instruction[25:21];
+                rt                  = 1;
+                rt_address          = instruction[20:16];
+                mac_select.MADD     = !instruction[2];
+                mac_select.MSUB     = instruction[2];
+                mac_select.UNSIGNED = instruction[0];
+            end
+            if (ACCELERATOR && (instruction[10:6] == 5'b00000) && (instruction[5:4] == 2'b01)) begin
+                // Custom Instructions, rd = function [3:0] of the accelerator on rs, rt
+                rs                     = 1;
+                rs_address             = instruction[25:21];
+                rt                     = 1;
+                rt_address             = instruction[20:16];
+                rd                     = 1;
+                rd_address             = instruction[15:11];
+                alu_mode               = 1;
+                alu_mode_value         = Decode::ALUMode_ADDU;
+                custom_select.CUSTOM   = 1;
+                custom_select.FUNCTION = instruction[3:0];
+            end
+        end
+        if (CP0 && (instruction[31:26] == 6'b010000)) begin
+            if ((instruction[25:21] == 5'b00000) && (instruction[10:0] == 11'b0)) begin
+                // mfc0 rt, rd, the value of rd is written back like an ALU result
+                rd                   = 1;
+                rd_address           = instruction[20:16];
+                alu_mode             = 1;
+                alu_mode_value       = Decode::ALUMode_ADDU;
+                cop0_select.MFC0     = 1;
+                cop0_select.REGISTER = instruction[15:11];
+            end
+            if ((instruction[25:21] == 5'b00100) && (instruction[10:0] == 11'b0)) begin
+                // mtc0 rt, rd
+                rt                   = 1;
+                rt_address           = instruction[20:16];
+                cop0_select.MTC0     = 1;
+                cop0_select.REGISTER = instruction[15:11];
+            end
+            if (instruction[25] == 1) begin
+                // rfe, eret
+                cop0_select.RFE  = (instruction[5:0] == 6'b010000);
+                cop0_select.ERET = (instruction[5:0] == 6'b011000);
             end
         end
         if (instruction[31:29] == 3'b001) begin
@@ -288,49 +498,230 @@ module parser (
                     end
                 end
             end
+            if (instruction[30:26] == 5'b10000) begin
+                // ll rt, offset(base)
+                rs                        = 1;
+                rs_address                = instruction[25:21];
+                rd                        = 1;
+                rd_address                = instruction[20:16];
+                imm                       = 1;
+                imm_value                 = instruction[15:0];
+                load                      = 1;
+                load_store_data_size_mode = Decode::LoadStoreDataSizeMode_WORD;
+                load_linked               = 1;
+            end
+            if (instruction[30:26] == 5'b11000) begin
+                // sc rt, offset(base), rt is written back like a load with the success flag
+                rs                        = 1;
+                rs_address                = instruction[25:21];
+                rt                        = 1;
+                rt_address                = instruction[20:16];
+                rd                        = 1;
+                rd_address                = instruction[20:16];
+                imm                       = 1;
+                imm_value                 = instruction[15:0];
+                load                      = 1;
+                store                     = 1;
+                load_store_data_size_mode = Decode::LoadStoreDataSizeMode_WORD;
+                store_conditional         = 1;
+            end
+        end
+    end
+endmodule
+
+// Expands the encoded modes into one-hot selects, so the ALU in EX only has to
+// AND-OR the candidate results instead of walking a priority chain. add, addi
+// and sub trap on signed overflow, their unsigned forms do not.
+module select_encoder (
+    input  var logic         alu_mode      ,
+    input  var logic [5-1:0] alu_mode_value,
+    input  var logic         link          ,
+    input  var logic         lui           ,
+    input  var logic         branch        ,
+    input  var logic [3-1:0] branch_mode   ,
+    input  var logic         load          ,
+    input  var logic         store         ,
+
+    output var Decode::ALUSelect    alu_select   ,
+    output var Decode::BranchSelect branch_select,
+    output var logic                trap
+);
+    always_comb begin
+        alu_select    = 0;
+        branch_select = 0;
+        trap          = alu_mode && !link && (
+            (alu_mode_value == Decode::ALUMode_ADD) || (alu_mode_value == Decode::ALUMode_SUB)
+        );
+        if (load || store) begin
+            alu_select.ADD = 1;
+        end else if (alu_mode) begin
+            alu_select.ADD  = !link && ((alu_mode_value == Decode::ALUMode_ADD) || (alu_mode_value == Decode::ALUMode_ADDU));
+            alu_select.LINK = link && (alu_mode_value == Decode::ALUMode_ADDU);
+            alu_select.SUB  = (alu_mode_value == Decode::ALUMode_SUB) || (alu_mode_value == Decode::ALUMode_SUBU);
+            alu_select.AND  = (alu_mode_value == Decode::ALUMode_AND);
+            alu_select.OR   = (alu_mode_value == Decode::ALUMode_OR);
+            alu_select.XOR  = (alu_mode_value == Decode::ALUMode_XOR);
+            alu_select.NOR  = (alu_mode_value == Decode::ALUMode_NOR);
+            alu_select.SLL  = !lui && (alu_mode_value == Decode::ALUMode_SLL);
+            alu_select.LUI  = lui && (alu_mode_value == Decode::ALUMode_SLL);
+            alu_select.SRL  = (alu_mode_value == Decode::ALUMode_SRL);
+            alu_select.SRA  = (alu_mode_value == Decode::ALUMode_SRA);
+            alu_select.SLT  = (alu_mode_value == Decode::ALUMode_SLT);
+            alu_select.SLTU = (alu_mode_value == Decode::ALUMode_SLTU);
+            alu_select.CLZ  = (alu_mode_value == Decode::ALUMode_CLZ);
+            alu_select.CLO  = (alu_mode_value == Decode::ALUMode_CLO);
+            alu_select.MOVZ = (alu_mode_value == Decode::ALUMode_MOVZ);
+            alu_select.MOVN = (alu_mode_value == Decode::ALUMode_MOVN);
+        end
+        if (branch) begin
+            branch_select.LT = (branch_mode == Decode::BranchMode_BLTZ);
+            branch_select.GE = (branch_mode == Decode::BranchMode_BGEZ);
+            branch_select.EQ = (branch_mode == Decode::BranchMode_BEQ);
+            branch_select.NE = (branch_mode == Decode::BranchMode_BNE);
+            branch_select.LE = (branch_mode == Decode::BranchMode_BLEZ);
+            branch_select.GT = (branch_mode == Decode::BranchMode_BGTZ);
         end
     end
 endmodule
 
-module registers (
+module registers #(
+    parameter int unsigned THREAD_COUNT = 1
+) (
     input var logic clk,
     input var logic nrst,
+    input var logic ce,
 
-    input var logic [Constants::REG_ADDR_WIDTH-1:0] rs_address,
-    input var logic [Constants::REG_ADDR_WIDTH-1:0] rt_address,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread    ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0]  rs_address,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0]  rt_address,
 
-    input var logic                                 rd        ,
-    input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address,
-    input var logic [Constants::WIDTH-1:0]          rd_data   ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0]  lane1_rs_address,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0]  lane1_rt_address,
+
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] rd_thread ,
+    input var logic                                  rd        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0]  rd_address,
+    input var logic [Constants::WIDTH-1:0]           rd_data   ,
+
+    input var logic                                  lane1_rd        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0]  lane1_rd_address,
+    input var logic [Constants::WIDTH-1:0]           lane1_rd_data   ,
 
     output var logic [Constants::WIDTH-1:0] rs_data,
     output var logic [Constants::WIDTH-1:0] rt_data,
+    output var logic [Constants::WIDTH-1:0] lane1_rs_data,
+    output var logic [Constants::WIDTH-1:0] lane1_rt_data,
     output var logic [Constants::WIDTH-1:0] reg_file [0:Constants::REG_COUNT - 1-1]
 );
+    logic [Constants::WIDTH-1:0] thread_reg_files [0:THREAD_COUNT-1][0:Constants::REG_COUNT - 1-1];
+
+    logic [Constants::REG_ADDR_WIDTH-1:0] read_addresses [0:4-1];
+    logic [Constants::WIDTH-1:0]          read_data      [0:4-1];
+
+    // Lane 1 is younger than lane 0 of the same group, so its write wins.
     always_comb begin
-        rs_data = (
-            (rs_address ==? 0) ? 0 : (
-                rd && (rd_address == rs_address)
-                ? rd_data
-                : reg_file[rs_address - 1]
-            )
+        reg_file          = thread_reg_files[0];
+        read_addresses[0] = rs_address;
+        read_addresses[1] = rt_address;
+        read_addresses[2] = lane1_rs_address;
+        read_addresses[3] = lane1_rt_address;
+        for (int unsigned i = 0; i < 4; i++) begin
+            if (read_addresses[i] == 0) begin
+                read_data[i] = 0;
+            end else if (lane1_rd && (rd_thread == thread) && (lane1_rd_address == read_addresses[i])) begin
+                read_data[i] = lane1_rd_data;
+            end else if (rd && (rd_thread == thread) && (rd_address == read_addresses[i])) begin
+                read_data[i] = rd_data;
+            end else begin
+                read_data[i] = thread_reg_files[thread][read_addresses[i] - 1];
+            end
+        end
+        rs_data       = read_data[0];
+        rt_data       = read_data[1];
+        lane1_rs_data = read_data[2];
+        lane1_rt_data = read_data[3];
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            for (int unsigned t = 0; t < THREAD_COUNT; t++) begin
+                for (int unsigned i = 0; i < (Constants::REG_COUNT - 1); i++) begin
+                    thread_reg_files[t][i] <= 0;
+                end
+            end
+        end else if (ce) begin
+            if (rd && (rd_address != 0)) begin
+                thread_reg_files[rd_thread][rd_address - 1] <= rd_data;
+            end
+            if (lane1_rd && (lane1_rd_address != 0)) begin
+                thread_reg_files[rd_thread][lane1_rd_address - 1] <= lane1_rd_data;
+            end
+        end
+    end
+endmodule
+
+module pairing_unit #(
+    parameter int unsigned ISSUE_WIDTH = 1
+) (
+    input var logic clk,
+    input var logic nrst,
+    input var logic ce,
+
+    input var logic                                 valid     ,
+    input var logic                                 branch    ,
+    input var logic                                 jump      ,
+    input var logic                                 load      ,
+    input var logic                                 rd        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address,
+
+    input var logic                                 lane1_alu_mode  ,
+    input var logic                                 lane1_load      ,
+    input var logic                                 lane1_store     ,
+    input var logic                                 lane1_branch    ,
+    input var logic                                 lane1_jump      ,
+    input var logic                                 lane1_rs        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rs_address,
+    input var logic                                 lane1_rt        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rt_address,
+
+    input var logic                                 load_ex      ,
+    input var logic                                 rd_ex        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_ex,
+
+    output var logic pair
+);
+    // Lane 1 only takes ALU operations that do not depend on lane 0. Branches
+    // and loads issue alone so their delay slot is the next group, just like
+    // on the scalar pipeline, and a branch delay slot never pairs with an
+    // instruction from the wrong path. Loaded data is only forwarded from WB,
+    // so lane 1 must not read a load that is still in EX either.
+    logic delay_slot;
+    logic depends;
+    logic depends_on_load;
+
+    always_comb begin
+        depends = rd && (rd_address != 0) && (
+            (lane1_rs && (lane1_rs_address == rd_address))
+            || (lane1_rt && (lane1_rt_address == rd_address))
+        );
+        depends_on_load = load_ex && rd_ex && (rd_address_ex != 0) && (
+            (lane1_rs && (lane1_rs_address == rd_address_ex))
+            || (lane1_rt && (lane1_rt_address == rd_address_ex))
         );
-        rt_data = (
-            (rt_address ==? 0) ? 0 : (
-                rd && (rd_address == rt_address)
-                ? rd_data
-                : reg_file[rt_address - 1]
-            )
+        pair = (
+            (ISSUE_WIDTH == 2)
+            && valid && !delay_slot
+            && !branch && !jump && !load
+            && lane1_alu_mode && !lane1_load && !lane1_store && !lane1_branch && !lane1_jump
+            && !depends && !depends_on_load
         );
     end
 
     always_ff @ (posedge clk, negedge nrst) begin
         if (!nrst) begin
-            for (int unsigned i = 0; i < (Constants::REG_COUNT - 1); i++) begin
-                reg_file[i] <= 0;
-            end
-        end else if (rd && (rd_address != 0)) begin
-            reg_file[rd_address - 1] <= rd_data;
+            delay_slot <= 0;
+        end else if (ce && valid) begin
+            delay_slot <= branch || jump;
         end
     end
 endmodule
@@ -338,198 +729,142 @@ endmodule
 module decode_buffer (
     input var logic clk,
     input var logic nrst,
+    input var logic ce,
+
+    input var logic                                  valid_in  ,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_in ,
+    input var logic [Constants::WIDTH-1:0]           pc_in     ,
+    input var Decode::Control                        control_in,
+    input var logic [Constants::WIDTH-1:0]           rs_data_in,
+    input var logic [Constants::WIDTH-1:0]           rt_data_in,
 
-    input var logic [Constants::WIDTH-1:0] pc_in,
-
-    input var logic                                 rs_in        ,
-    input var logic [Constants::REG_ADDR_WIDTH-1:0] rs_address_in,
-    input var logic [Constants::WIDTH-1:0]          rs_data_in   ,
-    input var logic                                 rt_in        ,
-    input var logic [Constants::REG_ADDR_WIDTH-1:0] rt_address_in,
-    input var logic [Constants::WIDTH-1:0]          rt_data_in   ,
-    input var logic                                 rd_in        ,
-    input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_in,
-
-    input var logic                               shamt_in       ,
-    input var logic [Constants::SHAMT_WIDTH-1:0]  shamt_value_in ,
-    input var logic                               imm_in         ,
-    input var logic [Constants::IMM_WIDTH-1:0]    imm_value_in   ,
-    input var logic                               target_in      ,
-    input var logic [Constants::TARGET_WIDTH-1:0] target_value_in,
-
-    input var logic         alu_mode_in      ,
-    input var logic [5-1:0] alu_mode_value_in,
-
-    input var logic         link_in       ,
-    input var logic         branch_in     ,
-    input var logic [3-1:0] branch_mode_in,
-    input var logic         jump_in       ,
-
-    input var logic         lui_in                      ,
-    input var logic         load_in                     ,
-    input var logic         load_sign_extend_in         ,
-    input var logic [2-1:0] load_store_data_size_mode_in,
-    input var logic         store_in                    ,
-
-    output var logic [Constants::WIDTH-1:0] pc_out,
-
-    output var logic                                 rs_out        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rs_address_out,
-    output var logic [Constants::WIDTH-1:0]          rs_data_out   ,
-    output var logic                                 rt_out        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rt_address_out,
-    output var logic [Constants::WIDTH-1:0]          rt_data_out   ,
-    output var logic                                 rd_out        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_out,
-
-    output var logic                               shamt_out       ,
-    output var logic [Constants::SHAMT_WIDTH-1:0]  shamt_value_out ,
-    output var logic                               imm_out         ,
-    output var logic [Constants::IMM_WIDTH-1:0]    imm_value_out   ,
-    output var logic                               target_out      ,
-    output var logic [Constants::TARGET_WIDTH-1:0] target_value_out,
-
-    output var logic         alu_mode_out      ,
-    output var logic [5-1:0] alu_mode_value_out,
-
-    output var logic         link_out       ,
-    output var logic         branch_out     ,
-    output var logic [3-1:0] branch_mode_out,
-    output var logic         jump_out       ,
-
-    output var logic         lui_out                      ,
-    output var logic         load_out                     ,
-    output var logic         load_sign_extend_out         ,
-    output var logic [2-1:0] load_store_data_size_mode_out,
-    output var logic         store_out                
+    output var logic                                  valid_out  ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_out ,
+    output var logic [Constants::WIDTH-1:0]           pc_out     ,
+    output var Decode::Control                        control_out,
+    output var logic [Constants::WIDTH-1:0]           rs_data_out,
+    output var logic [Constants::WIDTH-1:0]           rt_data_out
 );
     always_ff @ (posedge clk, negedge nrst) begin
         if (!nrst) begin
-            pc_out <= 0;
-
-            rs_out         <= 0;
-            rs_address_out <= 0;
-            rs_data_out    <= 0;
-            rt_out         <= 0;
-            rt_address_out <= 0;
-            rt_data_out    <= 0;
-            rd_out         <= 0;
-            rd_address_out <= 0;
-
-            shamt_out        <= 0;
-            shamt_value_out  <= 0;
-            imm_out          <= 0;
-            imm_value_out    <= 0;
-            target_out       <= 0;
-            target_value_out <= 0;
-
-            alu_mode_out       <= 0;
-            alu_mode_value_out <= 0;
-
-            link_out        <= 0;
-            branch_out      <= 0;
-            branch_mode_out <= 0;
-            jump_out        <= 0;
-
-            lui_out                       <= 0;
-            load_out                      <= 0;
-            load_sign_extend_out          <= 0;
-            load_store_data_size_mode_out <= 0;
-            store_out                     <= 0;
-        end else begin
-            pc_out <= pc_in;
-
-            rs_out         <= rs_in;
-            rs_address_out <= rs_address_in;
-            rs_data_out    <= rs_data_in;
-            rt_out         <= rt_in;
-            rt_address_out <= rt_address_in;
-            rt_data_out    <= rt_data_in;
-            rd_out         <= rd_in;
-            rd_address_out <= rd_address_in;
-
-            shamt_out        <= shamt_in;
-            shamt_value_out  <= shamt_value_in;
-            imm_out          <= imm_in;
-            imm_value_out    <= imm_value_in;
-            target_out       <= target_in;
-            target_value_out <= target_value_in;
-
-            alu_mode_out       <= alu_mode_in;
-            alu_mode_value_out <= alu_mode_value_in;
-
-            link_out        <= link_in;
-            branch_out      <= branch_in;
-            branch_mode_out <= branch_mode_in;
-            jump_out        <= jump_in;
-
-            lui_out                       <= lui_in;
-            load_out                      <= load_in;
-            load_sign_extend_out          <= load_sign_extend_in;
-            load_store_data_size_mode_out <= load_store_data_size_mode_in;
-            store_out                     <= store_in;
+            valid_out   <= 0;
+            thread_out  <= 0;
+            pc_out      <= 0;
+            control_out <= 0;
+            rs_data_out <= 0;
+            rt_data_out <= 0;
+        end else if (ce) begin
+            valid_out   <= valid_in;
+            thread_out  <= thread_in;
+            pc_out      <= pc_in;
+            control_out <= control_in;
+            rs_data_out <= rs_data_in;
+            rt_data_out <= rt_data_in;
         end
     end
 endmodule
 
-module decode (
+module decode #(
+    parameter int unsigned THREAD_COUNT        = 1,
+    parameter int unsigned ISSUE_WIDTH         = 1,
+    parameter bit          REGISTERED_REDIRECT = 0,
+    parameter int unsigned LOOP_BUFFER_SIZE    = 0,
+    parameter int unsigned PREFETCH_DEPTH      = 0,
+    parameter bit          EXTERNAL_MEMORY     = 0,
+    parameter bit          CP0                 = 0,
+    parameter bit          MULTIPLY_ACCUMULATE = 0,
+    parameter bit          ACCELERATOR         = 0
+) (
     input  var logic                        clk                ,
     input  var logic                        nrst               ,
+    input  var logic                        ce                 ,
+    input  var logic                        ce_if              ,
     input  var logic [Constants::BYTE-1:0]  rom [0:Constants::ROM_SIZE-1] ,
     input  var logic                        stall              ,
+    input  var logic                        instruction_request_ready_if ,
+    input  var logic                        instruction_response_valid_if,
+    input  var logic [Constants::WIDTH-1:0] instruction_response_data_if ,
     input  var logic                        branch_taken_ex       ,
     input  var logic [Constants::WIDTH-1:0] branch_target_ex      ,
+    input  var logic [Constants::THREAD_ID_WIDTH-1:0] branch_thread_ex,
+    input  var logic [Constants::WIDTH-1:0] branch_pc_ex          ,
+    input  var logic                        flush_if              ,
 
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_wb    ,
     input var logic                                 rd_wb        ,
     input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb,
     input var logic [Constants::WIDTH-1:0]          rd_data_wb   ,
 
+    input var logic                                 lane1_rd_wb        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address_wb,
+    input var logic [Constants::WIDTH-1:0]          lane1_rd_data_wb   ,
+
+    output var logic                        valid_if,
+    output var logic                        squash_if,
+    output var logic                        valid_id,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_id,
     output var logic [Constants::WIDTH-1:0] pc_id,
 
-    output var logic                                 rs_id        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rs_address_id,
-    output var logic [Constants::WIDTH-1:0]          rs_data_id   ,
-    output var logic                                 rt_id        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rt_address_id,
-    output var logic [Constants::WIDTH-1:0]          rt_data_id   ,
-    output var logic                                 rd_id        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_id,
-
-    output var logic                               shamt_id       ,
-    output var logic [Constants::SHAMT_WIDTH-1:0]  shamt_value_id ,
-    output var logic                               imm_id         ,
-    output var logic [Constants::IMM_WIDTH-1:0]    imm_value_id   ,
-    output var logic                               target_id      ,
-    output var logic [Constants::TARGET_WIDTH-1:0] target_value_id,
-
-    output var logic         alu_mode_id      ,
-    output var logic [5-1:0] alu_mode_value_id,
-
-    output var logic         link_id       ,
-    output var logic         branch_id     ,
-    output var logic [3-1:0] branch_mode_id,
-    output var logic         jump_id       ,
-
-    output var logic         lui_id                      ,
-    output var logic         load_id                     ,
-    output var logic         load_sign_extend_id         ,
-    output var logic [2-1:0] load_store_data_size_mode_id,
-    output var logic         store_id,
+    output var Decode::Control              control_id,
+    output var logic [Constants::WIDTH-1:0] rs_data_id,
+    output var logic [Constants::WIDTH-1:0] rt_data_id,
+
+    output var logic                        lane1_valid_id  ,
+    output var logic [Constants::WIDTH-1:0] lane1_pc_id     ,
+    output var Decode::Control              lane1_control_id,
+    output var logic [Constants::WIDTH-1:0] lane1_rs_data_id,
+    output var logic [Constants::WIDTH-1:0] lane1_rt_data_id,
+
+    output var logic                        rom_read_if          ,
+    output var logic                        instruction_request_valid_if  ,
+    output var logic [Constants::WIDTH-1:0] instruction_request_address_if,
+    output var logic [Constants::WIDTH-1:0] prefetch_issued_if   ,
+    output var logic [Constants::WIDTH-1:0] prefetch_used_if     ,
+    output var logic [Constants::WIDTH-1:0] prefetch_discarded_if,
 
     output var logic [Constants::WIDTH-1:0] reg_file [0:Constants::REG_COUNT - 1-1]
 );
+    var logic [Constants::THREAD_ID_WIDTH-1:0] thread_if;
     var logic [Constants::WIDTH-1:0] pc_if;
     var logic [Constants::WIDTH-1:0] instruction_if;
+    var logic [Constants::WIDTH-1:0] lane1_instruction_if;
+    var logic                        pair;
 
-    fetch fetch_inst (
+    fetch #(
+        .THREAD_COUNT        (THREAD_COUNT       ),
+        .ISSUE_WIDTH         (ISSUE_WIDTH        ),
+        .REGISTERED_REDIRECT (REGISTERED_REDIRECT),
+        .LOOP_BUFFER_SIZE    (LOOP_BUFFER_SIZE   ),
+        .PREFETCH_DEPTH      (PREFETCH_DEPTH     ),
+        .EXTERNAL_MEMORY     (EXTERNAL_MEMORY    )
+    ) fetch_inst (
         .clk(clk),
         .nrst(nrst),
+        .ce(ce_if),
+        .ce_core(ce),
         .rom(rom),
         .stall(stall),
+        .instruction_request_ready_if(instruction_request_ready_if),
+        .instruction_response_valid_if(instruction_response_valid_if),
+        .instruction_response_data_if(instruction_response_data_if),
         .branch_taken_ex(branch_taken_ex),
         .branch_target_ex(branch_target_ex),
+        .branch_thread_ex(branch_thread_ex),
+        .branch_pc_ex(branch_pc_ex),
+        .flush_if(flush_if),
+        .pair_id(pair),
+        .valid_if(valid_if),
+        .squash_if(squash_if),
+        .thread_if(thread_if),
         .pc_if(pc_if),
-        .instruction_if(instruction_if)
+        .instruction_if(instruction_if),
+        .lane1_instruction_if(lane1_instruction_if),
+        .rom_read_if(rom_read_if),
+        .instruction_request_valid_if(instruction_request_valid_if),
+        .instruction_request_address_if(instruction_request_address_if),
+        .prefetch_issued_if(prefetch_issued_if),
+        .prefetch_used_if(prefetch_used_if),
+        .prefetch_discarded_if(prefetch_discarded_if)
     );
 
     logic                                 rs        ;
@@ -559,8 +894,18 @@ module decode (
     logic         load_sign_extend         ;
     logic [2-1:0] load_store_data_size_mode;
     logic         store                    ;
+    logic         load_linked              ;
+    logic         store_conditional        ;
 
-    parser parser_inst (
+    Decode::Cop0Select   cop0_select  ;
+    Decode::MacSelect    mac_select   ;
+    Decode::CustomSelect custom_select;
+
+    parser #(
+        .CP0                 (CP0                ),
+        .MULTIPLY_ACCUMULATE (MULTIPLY_ACCUMULATE),
+        .ACCELERATOR         (ACCELERATOR        )
+    ) parser_inst (
         .instruction (instruction_if),
         .
         rs         (rs        ),
@@ -589,96 +934,292 @@ module decode (
         .load                      (load                     ),
         .load_sign_extend          (load_sign_extend         ),
         .load_store_data_size_mode (load_store_data_size_mode),
-        .store                     (store                    )
+        .store                     (store                    ),
+        .load_linked               (load_linked              ),
+        .store_conditional         (store_conditional        ),
+        .
+        cop0_select    (cop0_select  ),
+        .mac_select    (mac_select   ),
+        .custom_select (custom_select)
+    );
+
+    Decode::ALUSelect    alu_select   ;
+    Decode::BranchSelect branch_select;
+    logic                trap         ;
+    select_encoder select_encoder_inst (
+        .alu_mode       (alu_mode      ),
+        .alu_mode_value (alu_mode_value),
+        .link           (link          ),
+        .lui            (lui           ),
+        .branch         (branch        ),
+        .branch_mode    (branch_mode   ),
+        .load           (load          ),
+        .store          (store         ),
+        .
+        alu_select     (alu_select   ),
+        .branch_select (branch_select),
+        .trap          (trap         )
+    );
+
+    logic                                 lane1_rs        ;
+    logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rs_address;
+    logic                                 lane1_rt        ;
+    logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rt_address;
+    logic                                 lane1_rd        ;
+    logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address;
+
+    logic                               lane1_shamt       ;
+    logic [Constants::SHAMT_WIDTH-1:0]  lane1_shamt_value ;
+    logic                               lane1_imm         ;
+    logic [Constants::IMM_WIDTH-1:0]    lane1_imm_value   ;
+    logic                               lane1_target      ;
+    logic [Constants::TARGET_WIDTH-1:0] lane1_target_value;
+
+    logic         lane1_alu_mode      ;
+    logic [5-1:0] lane1_alu_mode_value;
+
+    logic         lane1_link       ;
+    logic         lane1_branch     ;
+    logic [3-1:0] lane1_branch_mode;
+    logic         lane1_jump       ;
+
+    logic         lane1_lui                      ;
+    logic         lane1_load                     ;
+    logic         lane1_load_sign_extend         ;
+    logic [2-1:0] lane1_load_store_data_size_mode;
+    logic         lane1_store                    ;
+    logic         lane1_load_linked              ;
+    logic         lane1_store_conditional        ;
+
+    Decode::Cop0Select   lane1_cop0_select_unused;
+    Decode::MacSelect    lane1_mac_select        ;
+    Decode::CustomSelect lane1_custom_select     ;
+
+    parser #(
+        .CP0                 (CP0                ),
+        .MULTIPLY_ACCUMULATE (MULTIPLY_ACCUMULATE),
+        .ACCELERATOR         (ACCELERATOR        )
+    ) lane1_parser_inst (
+        .instruction (lane1_instruction_if),
+        .
+        rs         (lane1_rs        ),
+        .rs_address (lane1_rs_address),
+        .rt         (lane1_rt        ),
+        .rt_address (lane1_rt_address),
+        .rd         (lane1_rd        ),
+        .rd_address (lane1_rd_address),
+        .
+        shamt        (lane1_shamt       ),
+        .shamt_value  (lane1_shamt_value ),
+        .imm          (lane1_imm         ),
+        .imm_value    (lane1_imm_value   ),
+        .target       (lane1_target      ),
+        .target_value (lane1_target_value),
+        .
+        alu_mode       (lane1_alu_mode      ),
+        .alu_mode_value (lane1_alu_mode_value),
+        .
+        link        (lane1_link       ),
+        .branch      (lane1_branch     ),
+        .branch_mode (lane1_branch_mode),
+        .jump        (lane1_jump       ),
+        .
+        lui                       (lane1_lui                      ),
+        .load                      (lane1_load                     ),
+        .load_sign_extend          (lane1_load_sign_extend         ),
+        .load_store_data_size_mode (lane1_load_store_data_size_mode),
+        .store                     (lane1_store                    ),
+        .load_linked               (lane1_load_linked              ),
+        .store_conditional         (lane1_store_conditional        ),
+        .
+        cop0_select    (lane1_cop0_select_unused),
+        .mac_select    (lane1_mac_select        ),
+        .custom_select (lane1_custom_select     )
+    );
+
+    Decode::ALUSelect    lane1_alu_select          ;
+    Decode::BranchSelect lane1_branch_select_unused;
+    logic                lane1_trap_unused         ;
+    select_encoder lane1_select_encoder_inst (
+        .alu_mode       (lane1_alu_mode && pair),
+        .alu_mode_value (lane1_alu_mode_value  ),
+        .link           (1'b0                  ),
+        .lui            (lane1_lui             ),
+        .branch         (1'b0                  ),
+        .branch_mode    (lane1_branch_mode     ),
+        .load           (1'b0                  ),
+        .store          (1'b0                  ),
+        .
+        alu_select     (lane1_alu_select          ),
+        .branch_select (lane1_branch_select_unused),
+        .trap          (lane1_trap_unused         )
+    );
+
+    // mfhi, mflo and custom instructions take their result from units only
+    // lane 0 has.
+    logic lane1_alu_only;
+    always_comb begin
+        lane1_alu_only = lane1_alu_mode && !lane1_mac_select.MFHI && !lane1_mac_select.MFLO && !lane1_custom_select.CUSTOM;
+    end
+
+    pairing_unit #(
+        .ISSUE_WIDTH(ISSUE_WIDTH)
+    ) pairing_unit_inst (
+        .clk  (clk ),
+        .nrst (nrst),
+        .ce   (ce  ),
+        .
+        valid       (valid_if  ),
+        .branch     (branch    ),
+        .jump       (jump      ),
+        .load       (load      ),
+        .rd         (rd        ),
+        .rd_address (rd_address),
+        .
+        lane1_alu_mode    (lane1_alu_only  ),
+        .lane1_load       (lane1_load      ),
+        .lane1_store      (lane1_store     ),
+        .lane1_branch     (lane1_branch    ),
+        .lane1_jump       (lane1_jump      ),
+        .lane1_rs         (lane1_rs        ),
+        .lane1_rs_address (lane1_rs_address),
+        .lane1_rt         (lane1_rt        ),
+        .lane1_rt_address (lane1_rt_address),
+        .
+        load_ex        (control_id.LOAD      ),
+        .rd_ex         (control_id.RD        ),
+        .rd_address_ex (control_id.RD_ADDRESS),
+        .
+        pair (pair)
     );
 
     logic [Constants::WIDTH-1:0] rs_data;
     logic [Constants::WIDTH-1:0] rt_data;
+    logic [Constants::WIDTH-1:0] lane1_rs_data;
+    logic [Constants::WIDTH-1:0] lane1_rt_data;
 
-    registers registers_inst (
+    registers #(
+        .THREAD_COUNT(THREAD_COUNT)
+    ) registers_inst (
         .clk (clk),
         .nrst (nrst),
+        .ce (ce),
         .
-        rs_address (rs_address),
+        thread     (thread_if ),
+        .rs_address (rs_address),
         .rt_address (rt_address),
+        .lane1_rs_address (lane1_rs_address),
+        .lane1_rt_address (lane1_rt_address),
         .
-        rd         (rd_wb        ),
+        rd_thread  (thread_wb    ),
+        .rd         (rd_wb        ),
         .rd_address (rd_address_wb),
         .rd_data    (rd_data_wb   ),
         .
+        lane1_rd         (lane1_rd_wb        ),
+        .lane1_rd_address (lane1_rd_address_wb),
+        .lane1_rd_data    (lane1_rd_data_wb   ),
+        .
         rs_data (rs_data),
         .rt_data (rt_data),
+        .lane1_rs_data (lane1_rs_data),
+        .lane1_rt_data (lane1_rt_data),
         .reg_file (reg_file)
     );
 
+    // IF keeps its last word while it is not valid, a bubble goes on with an
+    // empty control word.
+    Decode::Control control;
+    always_comb begin
+        control.RS                        = rs;
+        control.RS_ADDRESS                = rs_address;
+        control.RT                        = rt;
+        control.RT_ADDRESS                = rt_address;
+        control.RD                        = rd;
+        control.RD_ADDRESS                = rd_address;
+        control.SHAMT                     = shamt;
+        control.SHAMT_VALUE               = shamt_value;
+        control.IMM                       = imm;
+        control.IMM_VALUE                 = imm_value;
+        control.TARGET                    = target;
+        control.TARGET_VALUE              = target_value;
+        control.ALU_MODE                  = alu_mode;
+        control.LINK                      = link;
+        control.BRANCH                    = branch;
+        control.JUMP                      = jump;
+        control.LOAD                      = load;
+        control.LOAD_SIGN_EXTEND          = load_sign_extend;
+        control.LOAD_STORE_DATA_SIZE_MODE = load_store_data_size_mode;
+        control.STORE                     = store;
+        control.LOAD_LINKED               = load_linked;
+        control.STORE_CONDITIONAL         = store_conditional;
+        control.TRAP                      = trap;
+        control.ALU_SELECT                = alu_select;
+        control.BRANCH_SELECT             = branch_select;
+        control.COP0_SELECT               = cop0_select;
+        control.MAC_SELECT                = mac_select;
+        control.CUSTOM_SELECT             = custom_select;
+        if (!valid_if) begin
+            control = 0;
+        end
+    end
+
     decode_buffer decode_buffer_inst (
         .clk (clk),
         .nrst (nrst),
+        .ce (ce),
         .
-        pc_in (pc_if),
-        .
-        rs_in         (rs        ),
-        .rs_address_in (rs_address),
-        .rt_in         (rt        ),
-        .rt_address_in (rt_address),
-        .rd_in         (rd        ),
-        .rd_address_in (rd_address),
+        valid_in    (valid_if ),
+        .thread_in  (thread_if),
+        .pc_in      (pc_if    ),
+        .control_in (control  ),
+        .rs_data_in (rs_data  ),
+        .rt_data_in (rt_data  ),
         .
-        shamt_in        (shamt       ),
-        .shamt_value_in  (shamt_value ),
-        .imm_in          (imm         ),
-        .imm_value_in    (imm_value   ),
-        .target_in       (target      ),
-        .target_value_in (target_value),
-        .
-        alu_mode_in       (alu_mode      ),
-        .alu_mode_value_in (alu_mode_value),
-        .
-        link_in        (link       ),
-        .branch_in      (branch     ),
-        .branch_mode_in (branch_mode),
-        .jump_in        (jump       ),
-        .
-        lui_in                       (lui                      ),
-        .load_in                      (load                     ),
-        .load_sign_extend_in          (load_sign_extend         ),
-        .load_store_data_size_mode_in (load_store_data_size_mode),
-        .store_in                     (store                    ),
-        .
-        rs_data_in (rs_data),
-        .rt_data_in (rt_data),
-        .
-        pc_out (pc_id),
-        .
-        rs_out         (rs_id        ),
-        .rs_address_out (rs_address_id),
-        .rt_out         (rt_id        ),
-        .rt_address_out (rt_address_id),
-        .rd_out         (rd_id        ),
-        .rd_address_out (rd_address_id),
-        .
-        shamt_out        (shamt_id       ),
-        .shamt_value_out  (shamt_value_id ),
-        .imm_out          (imm_id         ),
-        .imm_value_out    (imm_value_id   ),
-        .target_out       (target_id      ),
-        .target_value_out (target_value_id),
-        .
-        alu_mode_out       (alu_mode_id      ),
-        .alu_mode_value_out (alu_mode_value_id),
-        .
-        link_out        (link_id       ),
-        .branch_out      (branch_id     ),
-        .branch_mode_out (branch_mode_id),
-        .jump_out        (jump_id       ),
+        valid_out    (valid_id  ),
+        .thread_out  (thread_id ),
+        .pc_out      (pc_id     ),
+        .control_out (control_id),
+        .rs_data_out (rs_data_id),
+        .rt_data_out (rt_data_id)
+    );
+
+    // Lane 1 only ever carries ALU operations, an unpaired slot is a bubble.
+    Decode::Control lane1_control;
+    always_comb begin
+        lane1_control             = 0;
+        lane1_control.RS          = lane1_rs;
+        lane1_control.RS_ADDRESS  = lane1_rs_address;
+        lane1_control.RT          = lane1_rt;
+        lane1_control.RT_ADDRESS  = lane1_rt_address;
+        lane1_control.RD          = lane1_rd && pair;
+        lane1_control.RD_ADDRESS  = lane1_rd_address;
+        lane1_control.SHAMT       = lane1_shamt;
+        lane1_control.SHAMT_VALUE = lane1_shamt_value;
+        lane1_control.IMM         = lane1_imm;
+        lane1_control.IMM_VALUE   = lane1_imm_value;
+        lane1_control.ALU_MODE    = lane1_alu_mode && pair;
+        lane1_control.ALU_SELECT  = lane1_alu_select;
+    end
+
+    logic [Constants::THREAD_ID_WIDTH-1:0] lane1_thread_id_unused;
+    decode_buffer lane1_decode_buffer_inst (
+        .clk (clk),
+        .nrst (nrst),
+        .ce (ce),
         .
-        lui_out                       (lui_id                      ),
-        .load_out                      (load_id                     ),
-        .load_sign_extend_out          (load_sign_extend_id         ),
-        .load_store_data_size_mode_out (load_store_data_size_mode_id),
-        .store_out                     (store_id                    ),
+        valid_in    (valid_if && pair),
+        .thread_in  (thread_if       ),
+        .pc_in      (pc_if + 4       ),
+        .control_in (lane1_control   ),
+        .rs_data_in (lane1_rs_data   ),
+        .rt_data_in (lane1_rt_data   ),
         .
-        rs_data_out (rs_data_id),
-        .rt_data_out (rt_data_id)
+        valid_out    (lane1_valid_id        ),
+        .thread_out  (lane1_thread_id_unused),
+        .pc_out      (lane1_pc_id           ),
+        .control_out (lane1_control_id      ),
+        .rs_data_out (lane1_rs_data_id      ),
+        .rt_data_out (lane1_rt_data_id      )
     );
 endmodule
\ No newline at end of file
@@ -1,9 +1,25 @@
 package Execute;
-    typedef enum logic [2-1:0] {
-        ForwarderSource_id = $bits(logic [2-1:0])'(2'b00),
-        ForwarderSource_ex = $bits(logic [2-1:0])'(2'b01),
-        ForwarderSource_WB = $bits(logic [2-1:0])'(2'b10)
+    typedef enum logic [3-1:0] {
+        ForwarderSource_id       = $bits(logic [3-1:0])'(3'b000),
+        ForwarderSource_ex       = $bits(logic [3-1:0])'(3'b001),
+        ForwarderSource_WB       = $bits(logic [3-1:0])'(3'b010),
+        ForwarderSource_ex_lane1 = $bits(logic [3-1:0])'(3'b101),
+        ForwarderSource_WB_lane1 = $bits(logic [3-1:0])'(3'b110)
     } ForwarderSource;
+
+    localparam logic [5-1:0]                COP0_BADVADDR            = 5'd8;
+    localparam logic [5-1:0]                COP0_STATUS              = 5'd12;
+    localparam logic [5-1:0]                COP0_CAUSE               = 5'd13;
+    localparam logic [5-1:0]                COP0_EPC                 = 5'd14;
+    localparam logic [5-1:0]                EXC_CODE_INT             = 5'd0;
+    localparam logic [5-1:0]                EXC_CODE_ADEL            = 5'd4;
+    localparam logic [5-1:0]                EXC_CODE_ADES            = 5'd5;
+    localparam logic [5-1:0]                EXC_CODE_SYS             = 5'd8;
+    localparam logic [5-1:0]                EXC_CODE_BP              = 5'd9;
+    localparam logic [5-1:0]                EXC_CODE_OV              = 5'd12;
+    localparam logic [Constants::WIDTH-1:0] EXCEPTION_VECTOR         = 32'h0000_0080;
+    localparam logic [Constants::WIDTH-1:0] INTERRUPT_VECTOR         = 32'h0000_0200;
+    localparam logic [Constants::WIDTH-1:0] INTERRUPT_VECTOR_SPACING = 32'h0000_0020;
 endpackage
 
 module imm_extender (
@@ -11,28 +27,13 @@ module imm_extender (
     input  var logic [Constants::IMM_WIDTH-1:0]   imm_value         ,
     input  var logic                              shamt             ,
     input  var logic [Constants::SHAMT_WIDTH-1:0] shamt_value       ,
-    input  var logic                              alu_mode          ,
-    input  var logic [5-1:0]                      alu_mode_value    ,
-    input  var logic                              load              ,
-    input  var logic                              store             ,
+    input  var Decode::ALUSelect                  alu_select        ,
     input  var logic                              branch            ,
     output var logic [Constants::WIDTH-1:0]       imm_value_extended
 );
     always_comb begin
         if (imm) begin
-            if (
-                (load | store | branch)
-                || (
-                    alu_mode
-                    && (
-                        (alu_mode_value == Decode::ALUMode_ADD)
-                        || (alu_mode_value == Decode::ALUMode_ADDU)
-                        || (alu_mode_value == Decode::ALUMode_SUB)
-                        || (alu_mode_value == Decode::ALUMode_SUBU)
-                        || (alu_mode_value == Decode::ALUMode_SLT)
-                    )
-                )
-            ) begin
+            if (branch || alu_select.ADD || alu_select.LINK || alu_select.SUB || alu_select.SLT) begin
                 imm_value_extended = {
                     (((imm_value[15] == 1) ==? (1)) ? (
                         16'hffff
@@ -56,7 +57,9 @@ module register_forwarder (
     input  var logic [Constants::WIDTH-1:0] r_data_id     ,
     input  var logic [Constants::WIDTH-1:0] alu_result_ex,
     input  var logic [Constants::WIDTH-1:0] rd_data_wb         ,
-    input  var logic [2-1:0]                selector           ,
+    input  var logic [Constants::WIDTH-1:0] lane1_alu_result_ex,
+    input  var logic [Constants::WIDTH-1:0] lane1_rd_data_wb   ,
+    input  var logic [3-1:0]                selector           ,
     output var logic [Constants::WIDTH-1:0] r_data_forwarded   
 );
     always_comb begin
@@ -66,6 +69,10 @@ module register_forwarder (
             alu_result_ex
         ) : ((selector) ==? (Execute::ForwarderSource_WB)) ? (
             rd_data_wb
+        ) : ((selector) ==? (Execute::ForwarderSource_ex_lane1)) ? (
+            lane1_alu_result_ex
+        ) : ((selector) ==? (Execute::ForwarderSource_WB_lane1)) ? (
+            lane1_rd_data_wb
         ) : (
             0
         ));
@@ -73,21 +80,33 @@ module register_forwarder (
 endmodule
 
 module forwarding_unit (
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread             ,
     input var logic                                 r                  ,
     input var logic [Constants::REG_ADDR_WIDTH-1:0] r_address          ,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_ex          ,
     input var logic                                 rd_ex        ,
     input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_ex,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_wb          ,
     input var logic                                 rd_wb              ,
     input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb      ,
+    input var logic                                 lane1_rd_ex        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address_ex,
+    input var logic                                 lane1_rd_wb        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address_wb,
 
-    output var logic [2-1:0] selector
+    output var logic [3-1:0] selector
 );
+    // Lane 1 is younger than lane 0 of the same group, so it is checked first.
     always_comb begin
         selector = Execute::ForwarderSource_id;
         if (r) begin
-            if ((rd_ex == 1) && (r_address == rd_address_ex)) begin
+            if ((lane1_rd_ex == 1) && (r_address == lane1_rd_address_ex) && (thread_ex == thread)) begin
+                selector = Execute::ForwarderSource_ex_lane1;
+            end else if ((rd_ex == 1) && (r_address == rd_address_ex) && (thread_ex == thread)) begin
                 selector = Execute::ForwarderSource_ex;
-            end else if ((rd_wb == 1) && (r_address == rd_address_wb)) begin
+            end else if ((lane1_rd_wb == 1) && (r_address == lane1_rd_address_wb) && (thread_wb == thread)) begin
+                selector = Execute::ForwarderSource_WB_lane1;
+            end else if ((rd_wb == 1) && (r_address == rd_address_wb) && (thread_wb == thread)) begin
                 selector = Execute::ForwarderSource_WB;
             end
         end
@@ -113,73 +132,60 @@ module alu (
     input var logic [Constants::WIDTH-1:0] a             ,
     input var logic [Constants::WIDTH-1:0] b             ,
     input var logic [Constants::WIDTH-1:0] pc            ,
-    input var logic                        link          ,
-    input var logic                        alu_mode      ,
-    input var logic [5-1:0]                alu_mode_value,
-    input var logic                        branch        ,
-    input var logic [3-1:0]                branch_mode   ,
-    input var logic                        lui           ,
-    input var logic                        load          ,
-    input var logic                        store         ,
+    input var Decode::ALUSelect            select        ,
+    input var Decode::BranchSelect         branch_select ,
 
     output var logic [Constants::WIDTH-1:0] result,
-    output var logic                        branch_result
+    output var logic                        branch_result,
+    output var logic                        overflow,
+    output var logic                        move_failed
 );
+    logic [Constants::WIDTH-1:0] sum          ;
+    logic [Constants::WIDTH-1:0] difference   ;
+    logic [Constants::WIDTH-1:0] count_input  ;
+    logic [6-1:0]                leading_count;
     always_comb begin
-        result = 0;
-        branch_result = 0;
-        if (branch) begin
-            branch_result = (
-                ((branch_mode) ==? (Decode::BranchMode_BLTZ)) ? (
-                    ($signed(a) < $signed(b))
-                ) : ((branch_mode) ==? (Decode::BranchMode_BGEZ)) ? (
-                    ($signed(a) >= $signed(b))
-                ) : ((branch_mode) ==? (Decode::BranchMode_BEQ)) ? (
-                    (a == b)
-                ) : ((branch_mode) ==? (Decode::BranchMode_BNE)) ? (
-                    (a != b)
-                ) : ((branch_mode) ==? (Decode::BranchMode_BLEZ)) ? (
-                    ($signed(a) <= $signed(b))
-                ) : ((branch_mode) ==? (Decode::BranchMode_BGTZ)) ? (
-                    ($signed(a) > $signed(b))
-                ) : (
-                    1'b0
-                )
-            );
-        end
-        if (load || store) begin
-            result = a + b;
-        end else if (alu_mode) begin
-            result = (((alu_mode_value) ==? (Decode::ALUMode_ADD)) ? (
-                (a + b)
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_ADDU)) ? (
-                ((link ==? 1) ? (pc + 4 + 4) : (a + b))
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_SUB)) ? (
-                (a - b)
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_SUBU)) ? (
-                (a - b)
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_AND)) ? (
-                (a & b)
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_OR)) ? (
-                (a | b)
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_XOR)) ? (
-                (a ^ b)
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_NOR)) ? (
-                ~(a | b)
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_SLL)) ? (
-                ((lui ==? 0) ? (a << b[4:0]) : (b << 16))
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_SRL)) ? (
-                (a >> b[4:0])
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_SRA)) ? (
-                (a >>> b[4:0])
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_SLT)) ? (
-                {31'b0, ($signed(a) < $signed(b))}
-            ) : ((alu_mode_value) ==? (Decode::ALUMode_SLTU)) ? (
-                {31'b0, (a < b)}
-            ) : (
-                0
-            ));
+        sum        = a + b;
+        difference = a - b;
+        overflow   = (
+            (select.ADD && (a[31] == b[31]) && (sum[31] != a[31]))
+            || (select.SUB && (a[31] != b[31]) && (difference[31] != a[31]))
+        );
+        // clo counts the leading zeros of the inverted operand
+        count_input   = select.CLO ? ~a : a;
+        leading_count = 32;
+        for (int unsigned i = 0; i < Constants::WIDTH; i++) begin
+            if (count_input[i]) begin
+                leading_count = 6'(31 - i);
+            end
         end
+        // movz and movn pass rs through, rd is dropped when rt fails the test
+        move_failed = (select.MOVZ && (b != 0)) || (select.MOVN && (b == 0));
+        branch_result = (
+            (branch_select.LT && ($signed(a) < $signed(b)))
+            || (branch_select.GE && ($signed(a) >= $signed(b)))
+            || (branch_select.EQ && (a == b))
+            || (branch_select.NE && (a != b))
+            || (branch_select.LE && ($signed(a) <= $signed(b)))
+            || (branch_select.GT && ($signed(a) > $signed(b)))
+        );
+        result = (
+            ({Constants::WIDTH{select.ADD}} & sum)
+            | ({Constants::WIDTH{select.LINK}} & (pc + 4 + 4))
+            | ({Constants::WIDTH{select.SUB}} & difference)
+            | ({Constants::WIDTH{select.AND}} & (a & b))
+            | ({Constants::WIDTH{select.OR}} & (a | b))
+            | ({Constants::WIDTH{select.XOR}} & (a ^ b))
+            | ({Constants::WIDTH{select.NOR}} & ~(a | b))
+            | ({Constants::WIDTH{select.SLL}} & (a << b[4:0]))
+            | ({Constants::WIDTH{select.LUI}} & (b << 16))
+            | ({Constants::WIDTH{select.SRL}} & (a >> b[4:0]))
+            | ({Constants::WIDTH{select.SRA}} & (a >>> b[4:0]))
+            | ({Constants::WIDTH{select.SLT}} & {31'b0, ($signed(a) < $signed(b))})
+            | ({Constants::WIDTH{select.SLTU}} & {31'b0, (a < b)})
+            | ({Constants::WIDTH{select.CLZ | select.CLO}} & {26'b0, leading_count})
+            | ({Constants::WIDTH{select.MOVZ | select.MOVN}} & a)
+        );
     end
 endmodule
 
@@ -201,15 +207,20 @@ module brancher (
     output var logic [Constants::WIDTH-1:0] branch_target,
     output var logic                        rd_branched
 );
+    logic [Constants::WIDTH-1:0] pc_plus_4;
+    always_comb begin
+        pc_plus_4 = pc + 4;
+    end
+
     always_comb begin
         branch_target = 0;
         branch_taken  = (jump | (branch & branch_comparison_result));
         rd_branched = rd;
         if (branch | jump) begin
             if (target) begin
-                branch_target = {4'b00, target_value, 2'b00};
+                branch_target = {pc_plus_4[31:28], target_value, 2'b00};
             end else if (imm) begin
-                branch_target = (pc + 4) + (imm_value <<< 2);
+                branch_target = pc_plus_4 + (imm_value <<< 2);
             end else if (rs) begin
                 branch_target = rs_data;
             end
@@ -218,234 +229,639 @@ module brancher (
     end
 endmodule
 
-module execute_buffer (
+module idle_detector #(
+    parameter int unsigned THREAD_COUNT = 1
+) (
     input var logic clk,
     input var logic nrst,
+    input var logic ce,
+    input var logic stall,
 
-    input var logic [Constants::WIDTH-1:0] pc_in        ,
-    input var logic                        alu_mode_in  ,
-    input var logic [Constants::WIDTH-1:0] alu_result_in,
+    input var logic                                  valid        ,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread       ,
+    input var logic [Constants::WIDTH-1:0]           pc           ,
+    input var logic                                  branch_taken ,
+    input var logic [Constants::WIDTH-1:0]           branch_target,
+    input var logic                                  rd           ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0]  rd_address   ,
+    input var logic                                  store        ,
+    input var logic                                  load         ,
+    input var Decode::Cop0Select                     cop0_select  ,
+    input var Decode::MacSelect                      mac_select   ,
+    input var Decode::CustomSelect                   custom_select,
 
-    input var logic [Constants::WIDTH-1:0] rt_data_in,
+    output var logic [THREAD_COUNT-1:0] idle
+);
+    // A taken branch to itself with a side effect free delay slot never leaves
+    // the loop, report the thread idle once both have drained out of EX. Loads
+    // may read memory mapped registers and HI/LO, CP0 and the accelerator keep
+    // state outside the register file, none of them are side effect free.
+    logic side_effect_free;
+    logic self_loop;
+    always_comb begin
+        side_effect_free = !store && !load && !(rd && (rd_address != 0))
+            && !(cop0_select.MFC0 || cop0_select.MTC0 || cop0_select.RFE || cop0_select.ERET || cop0_select.SYSCALL || cop0_select.BREAK)
+            && !(mac_select.MULT || mac_select.MADD || mac_select.MSUB || mac_select.MFHI || mac_select.MFLO || mac_select.MTHI || mac_select.MTLO)
+            && !custom_select.CUSTOM;
+        self_loop        = branch_taken && (branch_target == pc) && side_effect_free && !stall;
+    end
 
-    input var logic                                 rd_in        ,
-    input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_in,
+    logic [THREAD_COUNT-1:0] self_loop_pending;
+    logic [THREAD_COUNT-1:0] delay_slot_pending;
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            self_loop_pending  <= 0;
+            delay_slot_pending <= 0;
+            idle               <= 0;
+        end else if (ce) begin
+            if (valid || (THREAD_COUNT == 1)) begin
+                self_loop_pending[thread]  <= self_loop;
+                delay_slot_pending[thread] <= self_loop_pending[thread] && side_effect_free && !branch_taken && !stall;
+            end
+            idle <= idle | delay_slot_pending;
+        end
+    end
+endmodule
 
-    input var logic         load_in                     ,
-    input var logic [2-1:0] load_store_data_size_mode_in,
-    input var logic         load_sign_extend_in         ,
-    input var logic         store_in                    ,
+// Status, Cause, EPC and BadVAddr of coprocessor 0. Exceptions are taken on
+// the instruction in EX, where branches resolve. It is cancelled together with
+// the word behind it in IF while everything older has already left EX, so the
+// exception is precise. A pending and enabled interrupt is taken on the next
+// valid instruction in EX and fetch is redirected in the same cycle, the first
+// instruction of its vector reaches EX two cycles later. Status keeps the
+// KU/IE stack of the R2000, entry pushes it, rfe and eret pop it.
+module coprocessor0 (
+    input var logic clk ,
+    input var logic nrst,
+    input var logic ce  ,
 
-    output var logic [Constants::WIDTH-1:0] pc_out        ,
-    output var logic                        alu_mode_out  ,
-    output var logic [Constants::WIDTH-1:0] alu_result_out,
+    input var logic                        valid                    ,
+    input var logic [Constants::WIDTH-1:0] pc                       ,
+    input var logic                        branch                   ,
+    input var Decode::Cop0Select           select                   ,
+    input var logic [Constants::WIDTH-1:0] write_data               ,
+    input var logic                        overflow                 ,
+    input var logic                        load                     ,
+    input var logic                        store                    ,
+    input var logic [2-1:0]                load_store_data_size_mode,
+    input var logic [Constants::WIDTH-1:0] address                  ,
+    input var logic [6-1:0]                interrupts               ,
 
-    output var logic [Constants::WIDTH-1:0] rt_data_out,
+    output var logic [Constants::WIDTH-1:0] read_data         ,
+    output var logic                        exception         ,
+    output var logic                        redirect          ,
+    output var logic [Constants::WIDTH-1:0] target            ,
+    output var logic                        interrupts_enabled
+);
+    logic [Constants::WIDTH-1:0] status    ;
+    logic [Constants::WIDTH-1:0] cause     ;
+    logic [Constants::WIDTH-1:0] epc       ;
+    logic [Constants::WIDTH-1:0] bad_vaddr ;
+    logic                        delay_slot;
 
-    output var logic                                 rd_out        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_out,
+    logic [8-1:0] pending      ;
+    logic         interrupt    ;
+    logic [3-1:0] vector       ;
+    logic         address_error;
+    logic [5-1:0] exc_code     ;
+    always_comb begin
+        pending            = {interrupts, cause[9:8]} & status[15:8];
+        interrupt          = status[0] && (pending != 0);
+        interrupts_enabled = status[0] && (status[15:8] != 0);
+        vector             = 0;
+        for (int unsigned i = 0; i < 8; i++) begin
+            if (pending[i]) begin
+                vector = 3'(i);
+            end
+        end
+        address_error = (load || store) && (
+            ((load_store_data_size_mode == Decode::LoadStoreDataSizeMode_WORD) && (address[1:0] != 0))
+            || ((load_store_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) && address[0])
+        );
 
-    output var logic         load_out                     ,
-    output var logic [2-1:0] load_store_data_size_mode_out,
-    output var logic         load_sign_extend_out         ,
-    output var logic         store_out                    
-);
+        if (interrupt) begin
+            exc_code = Execute::EXC_CODE_INT;
+        end else if (address_error) begin
+            exc_code = store ? Execute::EXC_CODE_ADES : Execute::EXC_CODE_ADEL;
+        end else if (select.SYSCALL) begin
+            exc_code = Execute::EXC_CODE_SYS;
+        end else if (select.BREAK) begin
+            exc_code = Execute::EXC_CODE_BP;
+        end else begin
+            exc_code = Execute::EXC_CODE_OV;
+        end
+        exception = valid && (interrupt || address_error || select.SYSCALL || select.BREAK || overflow);
+        redirect  = exception || (valid && select.ERET);
+        if (exception && interrupt) begin
+            target = Execute::INTERRUPT_VECTOR + ({29'b0, vector} * Execute::INTERRUPT_VECTOR_SPACING);
+        end else if (exception) begin
+            target = Execute::EXCEPTION_VECTOR;
+        end else begin
+            target = epc;
+        end
+
+        if (select.REGISTER == Execute::COP0_BADVADDR) begin
+            read_data = bad_vaddr;
+        end else if (select.REGISTER == Execute::COP0_STATUS) begin
+            read_data = status;
+        end else if (select.REGISTER == Execute::COP0_CAUSE) begin
+            read_data = {cause[31:16], interrupts, cause[9:0]};
+        end else if (select.REGISTER == Execute::COP0_EPC) begin
+            read_data = epc;
+        end else begin
+            read_data = 0;
+        end
+    end
+
+    // An exception in a delay slot restarts at the branch, Cause.BD tells the
+    // handler.
     always_ff @ (posedge clk, negedge nrst) begin
         if (!nrst) begin
-            pc_out         <= 0;
-            alu_mode_out   <= 0;
-            alu_result_out <= 0;
+            status     <= 0;
+            cause      <= 0;
+            epc        <= 0;
+            bad_vaddr  <= 0;
+            delay_slot <= 0;
+        end else if (ce && valid) begin
+            delay_slot <= branch && !exception;
+            if (exception) begin
+                status[5:0] <= {status[3:0], 2'b00};
+                cause[31]   <= delay_slot;
+                cause[6:2]  <= exc_code;
+                epc         <= delay_slot ? (pc - 4) : pc;
+                if (!interrupt && address_error) begin
+                    bad_vaddr <= address;
+                end
+            end else if (select.RFE || select.ERET) begin
+                status[3:0] <= status[5:2];
+            end else if (select.MTC0) begin
+                if (select.REGISTER == Execute::COP0_STATUS) begin
+                    status <= write_data & 32'h0000_ff3f;
+                end
+                if (select.REGISTER == Execute::COP0_CAUSE) begin
+                    cause[9:8] <= write_data[9:8];
+                end
+                if (select.REGISTER == Execute::COP0_EPC) begin
+                    epc <= write_data;
+                end
+            end
+        end
+    end
+endmodule
+
+// HI/LO of every thread and the multiplier behind mult, madd and msub. The
+// 64 bit result is built over CYCLES cycles in EX, one DIGIT_WIDTH bit digit
+// of rt per cycle times rs added to or, for msub, taken off the running sum,
+// so each cycle only has a 33 by 9 bit multiply and one 64 bit add. busy holds
+// the pipeline until the last digit, whose sum goes to HI/LO as the
+// instruction leaves EX, so an mfhi or mflo right behind still reads the new
+// value. The top digit of a signed rt carries the sign. HI/LO only change on
+// that last cycle, an exception taken meanwhile restarts the instruction.
+module multiply_accumulate #(
+    parameter int unsigned THREAD_COUNT = 1
+) (
+    input var logic clk ,
+    input var logic nrst,
+    input var logic ce  ,
 
-            rt_data_out <= 0;
+    input var logic                                  valid ,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread,
+    input var Decode::MacSelect                      select,
+    input var logic [Constants::WIDTH-1:0]           a     ,
+    input var logic [Constants::WIDTH-1:0]           b     ,
+
+    output var logic                        busy     ,
+    output var logic [Constants::WIDTH-1:0] read_data
+);
+    localparam int unsigned DIGIT_WIDTH = 8;
+    localparam int unsigned CYCLES      = Constants::WIDTH / DIGIT_WIDTH;
 
-            rd_out         <= 0;
-            rd_address_out <= 0;
+    logic [2*Constants::WIDTH-1:0] hi_lo [0:THREAD_COUNT-1];
+    logic [2*Constants::WIDTH-1:0] sum ;
+    int unsigned                   step;
 
-            load_out                      <= 0;
-            load_store_data_size_mode_out <= 0;
-            load_sign_extend_out          <= 0;
-            store_out                     <= 0;
+    logic                                      multiply     ;
+    logic [Constants::WIDTH+1-1:0]             a_extended   ;
+    logic [DIGIT_WIDTH+1-1:0]                  digit        ;
+    logic [Constants::WIDTH+DIGIT_WIDTH+2-1:0] digit_product;
+    logic [2*Constants::WIDTH-1:0]             partial      ;
+    logic [2*Constants::WIDTH-1:0]             base         ;
+    logic [2*Constants::WIDTH-1:0]             accumulated  ;
+    always_comb begin
+        multiply      = select.MULT || select.MADD || select.MSUB;
+        busy          = valid && multiply && (step != CYCLES - 1);
+        a_extended    = {a[Constants::WIDTH-1] && !select.UNSIGNED, a};
+        digit         = {(step == CYCLES - 1) && b[Constants::WIDTH-1] && !select.UNSIGNED, b[step*DIGIT_WIDTH +: DIGIT_WIDTH]};
+        digit_product = $signed(a_extended) * $signed(digit);
+        partial       = {{(2*Constants::WIDTH-Constants::WIDTH-DIGIT_WIDTH-2){digit_product[Constants::WIDTH+DIGIT_WIDTH+2-1]}}, digit_product} << (step * DIGIT_WIDTH);
+        if (step != 0) begin
+            base = sum;
+        end else if (select.MULT) begin
+            base = 0;
         end else begin
-            pc_out         <= pc_in;
-            alu_mode_out   <= alu_mode_in;
-            alu_result_out <= alu_result_in;
+            base = hi_lo[thread];
+        end
+        if (select.MSUB) begin
+            accumulated = base - partial;
+        end else begin
+            accumulated = base + partial;
+        end
+
+        if (select.MFHI) begin
+            read_data = hi_lo[thread][2*Constants::WIDTH-1:Constants::WIDTH];
+        end else if (select.MFLO) begin
+            read_data = hi_lo[thread][Constants::WIDTH-1:0];
+        end else begin
+            read_data = 0;
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            for (int unsigned t = 0; t < THREAD_COUNT; t++) begin
+                hi_lo[t] <= 0;
+            end
+            sum  <= 0;
+            step <= 0;
+        end else if (ce) begin
+            step <= 0;
+            if (valid) begin
+                if (multiply) begin
+                    hi_lo[thread] <= accumulated;
+                end
+                if (select.MTHI) begin
+                    hi_lo[thread][2*Constants::WIDTH-1:Constants::WIDTH] <= a;
+                end
+                if (select.MTLO) begin
+                    hi_lo[thread][Constants::WIDTH-1:0] <= a;
+                end
+            end
+        end else if (busy) begin
+            sum  <= accumulated;
+            step <= step + 1;
+        end
+    end
+endmodule
+
+// Core side of the custom instruction port. A custom instruction in EX sends
+// its function and forwarded rs, rt to the accelerator and holds the pipeline
+// through busy until the response arrives. Both directions are valid/ready
+// handshakes, the response may come in the cycle the request is taken or any
+// later one and is kept here if the pipeline is held for another reason. Once
+// taken a request is always completed, an interrupt is only taken on the
+// instruction afterwards and restarts it, so operations have to be free of side
+// effects. The response becomes the result of the instruction and goes on to
+// memory_buffer like an ALU result.
+module accelerator_port (
+    input var logic clk ,
+    input var logic nrst,
+    input var logic ce  ,
 
-            rt_data_out <= rt_data_in;
+    input var logic                        valid    ,
+    input var Decode::CustomSelect         select   ,
+    input var logic                        exception,
+    input var logic [Constants::WIDTH-1:0] a        ,
+    input var logic [Constants::WIDTH-1:0] b        ,
 
-            rd_out         <= rd_in;
-            rd_address_out <= rd_address_in;
+    output var logic                        busy  ,
+    output var logic [Constants::WIDTH-1:0] result,
+
+    output var logic                        request_valid   ,
+    input  var logic                        request_ready   ,
+    output var logic [4-1:0]                request_function,
+    output var logic [Constants::WIDTH-1:0] request_a       ,
+    output var logic [Constants::WIDTH-1:0] request_b       ,
+    input  var logic                        response_valid  ,
+    output var logic                        response_ready  ,
+    input  var logic [Constants::WIDTH-1:0] response_data
+);
+    logic                        requested    ;
+    logic                        responded    ;
+    logic [Constants::WIDTH-1:0] response_kept;
+    always_comb begin
+        request_valid    = valid && select.CUSTOM && !exception && !requested && !responded;
+        request_function = select.FUNCTION;
+        request_a        = a;
+        request_b        = b;
+        response_ready   = requested || request_valid;
+        busy             = valid && select.CUSTOM && (requested || !exception) && !responded && !response_valid;
+        result           = responded ? response_kept : response_data;
+    end
 
-            load_out                      <= load_in;
-            load_store_data_size_mode_out <= load_store_data_size_mode_in;
-            load_sign_extend_out          <= load_sign_extend_in;
-            store_out                     <= store_in;
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            requested     <= 0;
+            responded     <= 0;
+            response_kept <= 0;
+        end else if (ce) begin
+            requested <= 0;
+            responded <= 0;
+        end else if (response_valid && response_ready) begin
+            requested     <= 0;
+            responded     <= 1;
+            response_kept <= response_data;
+        end else if (request_valid && request_ready) begin
+            requested <= 1;
         end
     end
 endmodule
 
-module execute (
+// Example accelerator for the custom instruction port, one compare and swap
+// step of an odd-even transposition sort over the 8 unsigned bytes of rs, rt,
+// lowest address first. Function bit 0 picks the odd step, bit 1 returns the
+// word of rt instead of rs. The result is registered, so it answers one cycle
+// after taking a request.
+module byte_sort_accelerator (
+    input var logic clk ,
+    input var logic nrst,
+
+    input  var logic                        request_valid   ,
+    output var logic                        request_ready   ,
+    input  var logic [4-1:0]                request_function,
+    input  var logic [Constants::WIDTH-1:0] request_a       ,
+    input  var logic [Constants::WIDTH-1:0] request_b       ,
+    output var logic                        response_valid  ,
+    input  var logic                        response_ready  ,
+    output var logic [Constants::WIDTH-1:0] response_data
+);
+    logic [2*Constants::WIDTH-1:0] bytes ;
+    logic [2*Constants::WIDTH-1:0] sorted;
+    always_comb begin
+        request_ready = !response_valid;
+        bytes         = {request_a, request_b};
+        sorted        = bytes;
+        for (int unsigned i = 0; i < 7; i++) begin
+            if ((i[0] == request_function[0]) && (bytes[(7-i)*Constants::BYTE +: Constants::BYTE] > bytes[(6-i)*Constants::BYTE +: Constants::BYTE])) begin
+                sorted[(7-i)*Constants::BYTE +: Constants::BYTE] = bytes[(6-i)*Constants::BYTE +: Constants::BYTE];
+                sorted[(6-i)*Constants::BYTE +: Constants::BYTE] = bytes[(7-i)*Constants::BYTE +: Constants::BYTE];
+            end
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            response_valid <= 0;
+            response_data  <= 0;
+        end else if (request_valid && request_ready) begin
+            response_valid <= 1;
+            response_data  <= request_function[1] ? sorted[Constants::WIDTH-1:0] : sorted[2*Constants::WIDTH-1:Constants::WIDTH];
+        end else if (response_valid && response_ready) begin
+            response_valid <= 0;
+        end
+    end
+endmodule
+
+module execute_buffer (
+    input var logic clk,
+    input var logic nrst,
+    input var logic ce,
+
+    input var logic                                  valid_in     ,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_in    ,
+    input var logic [Constants::WIDTH-1:0]           pc_in        ,
+    input var Decode::Control                        control_in   ,
+    input var logic [Constants::WIDTH-1:0]           alu_result_in,
+    input var logic [Constants::WIDTH-1:0]           rt_data_in   ,
+
+    output var logic                                  valid_out     ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_out    ,
+    output var logic [Constants::WIDTH-1:0]           pc_out        ,
+    output var Decode::Control                        control_out   ,
+    output var logic [Constants::WIDTH-1:0]           alu_result_out,
+    output var logic [Constants::WIDTH-1:0]           rt_data_out
+);
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            valid_out      <= 0;
+            thread_out     <= 0;
+            pc_out         <= 0;
+            control_out    <= 0;
+            alu_result_out <= 0;
+            rt_data_out    <= 0;
+        end else if (ce) begin
+            valid_out      <= valid_in;
+            thread_out     <= thread_in;
+            pc_out         <= pc_in;
+            control_out    <= control_in;
+            alu_result_out <= alu_result_in;
+            rt_data_out    <= rt_data_in;
+        end
+    end
+endmodule
+
+module execute #(
+    parameter int unsigned THREAD_COUNT        = 1,
+    parameter int unsigned ISSUE_WIDTH         = 1,
+    parameter bit          REGISTERED_REDIRECT = 0,
+    parameter int unsigned LOOP_BUFFER_SIZE    = 0,
+    parameter int unsigned PREFETCH_DEPTH      = 0,
+    parameter bit          EXTERNAL_MEMORY     = 0,
+    parameter bit          CP0                 = 0,
+    parameter bit          MULTIPLY_ACCUMULATE = 0,
+    parameter bit          ACCELERATOR         = 0
+) (
     input  var logic                        clk                ,
     input  var logic                        nrst                ,
+    input  var logic                        ce                 ,
+    input  var logic                        ce_id              ,
+    input  var logic                        ce_if              ,
     input  var logic [Constants::BYTE-1:0]  rom     [0:Constants::ROM_SIZE-1] ,
     input  var logic                        stall              ,
+    input  var logic                        flush_if           ,
+    input  var logic                        flush_id           ,
+    input  var logic                        instruction_request_ready_if ,
+    input  var logic                        instruction_response_valid_if,
+    input  var logic [Constants::WIDTH-1:0] instruction_response_data_if ,
+    input  var logic [6-1:0]                interrupts         ,
 
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_wb    ,
     input var logic                                 rd_wb        ,
     input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb,
     input var logic [Constants::WIDTH-1:0]          rd_data_wb   ,
 
-    output var logic [Constants::WIDTH-1:0] pc_ex           ,
+    input var logic                                 lane1_rd_wb        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address_wb,
+    input var logic [Constants::WIDTH-1:0]          lane1_rd_data_wb   ,
 
-    output var logic                                 rd_ex        ,
-    output var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_ex,
+    output var logic                        valid_if        ,
+    output var logic                        squash_if       ,
+    output var logic                        valid_ex        ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_ex,
+    output var logic [Constants::WIDTH-1:0] pc_ex           ,
 
-    output var logic                        alu_mode_ex  ,
+    output var Decode::Control              control_ex   ,
     output var logic [Constants::WIDTH-1:0] alu_result_ex,
+    output var logic [Constants::WIDTH-1:0] rt_data_ex   ,
+
+    output var logic [THREAD_COUNT-1:0]     idle_ex,
+    output var logic                        accelerator_busy_ex,
+    output var logic                        mac_busy_ex        ,
+    output var logic                        cop0_exception_ex  ,
+    output var logic                        cop0_redirect_ex   ,
+    output var logic                        rom_read_if,
+    output var logic                        instruction_request_valid_if  ,
+    output var logic [Constants::WIDTH-1:0] instruction_request_address_if,
+    output var logic [Constants::WIDTH-1:0] prefetch_issued_if   ,
+    output var logic [Constants::WIDTH-1:0] prefetch_used_if     ,
+    output var logic [Constants::WIDTH-1:0] prefetch_discarded_if,
 
-    output var logic [Constants::WIDTH-1:0] rt_data_ex,
+    output var logic                        lane1_valid_ex     ,
+    output var logic [Constants::WIDTH-1:0] lane1_pc_ex        ,
+    output var Decode::Control              lane1_control_ex   ,
+    output var logic [Constants::WIDTH-1:0] lane1_alu_result_ex,
 
-    output var logic         load_ex                     ,
-    output var logic [2-1:0] load_store_data_size_mode_ex,
-    output var logic         load_sign_extend_ex         ,
-    output var logic         store_ex,
     output var logic [Constants::WIDTH-1:0] reg_file [0:Constants::REG_COUNT - 1-1]
 );
+    var logic                        valid_id;
+    var logic [Constants::THREAD_ID_WIDTH-1:0] thread_id;
     var logic [Constants::WIDTH-1:0] pc_id;
 
-    var logic                                 rs_id;
-    var logic [Constants::REG_ADDR_WIDTH-1:0] rs_address_id;
-    var logic [Constants::WIDTH-1:0]          rs_data_id;
-    var logic                                 rt_id;
-    var logic [Constants::REG_ADDR_WIDTH-1:0] rt_address_id;
-    var logic [Constants::WIDTH-1:0]          rt_data_id;
-    var logic                                 rd_id;
-    var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_id;
-
-    var logic                               shamt_id;
-    var logic [Constants::SHAMT_WIDTH-1:0]  shamt_value_id ;
-    var logic                               imm_id;
-    var logic [Constants::IMM_WIDTH-1:0]    imm_value_id;
-    var logic                               target_id;
-    var logic [Constants::TARGET_WIDTH-1:0] target_value_id;
-
-    var logic         alu_mode_id;
-    var logic [5-1:0] alu_mode_value_id;
-
-    var logic         link_id;
-    var logic         branch_id;
-    var logic [3-1:0] branch_mode_id;
-    var logic         jump_id;
-
-    var logic         lui_id;
-    var logic         load_id;
-    var logic         load_sign_extend_id;
-    var logic [2-1:0] load_store_data_size_mode_id;
-    var logic         store_id;
+    var Decode::Control              control_id;
+    var logic [Constants::WIDTH-1:0] rs_data_id;
+    var logic [Constants::WIDTH-1:0] rt_data_id;
+
+    var logic                        lane1_valid_id  ;
+    var logic [Constants::WIDTH-1:0] lane1_pc_id     ;
+    var Decode::Control              lane1_control_id;
+    var logic [Constants::WIDTH-1:0] lane1_rs_data_id;
+    var logic [Constants::WIDTH-1:0] lane1_rt_data_id;
 
     var logic                        branch_taken_branched;
     var logic [Constants::WIDTH-1:0] branch_target_branched;
+    var logic                        cop0_redirect         ;
+    var logic [Constants::WIDTH-1:0] cop0_target           ;
 
-    decode decode_inst (
+    decode #(
+        .THREAD_COUNT        (THREAD_COUNT       ),
+        .ISSUE_WIDTH         (ISSUE_WIDTH        ),
+        .REGISTERED_REDIRECT (REGISTERED_REDIRECT),
+        .LOOP_BUFFER_SIZE    (LOOP_BUFFER_SIZE   ),
+        .PREFETCH_DEPTH      (PREFETCH_DEPTH     ),
+        .EXTERNAL_MEMORY     (EXTERNAL_MEMORY    ),
+        .CP0                 (CP0                ),
+        .MULTIPLY_ACCUMULATE (MULTIPLY_ACCUMULATE),
+        .ACCELERATOR         (ACCELERATOR        )
+    ) decode_inst (
         .clk(clk),
         .nrst(nrst),
+        .ce(ce_id),
+        .ce_if(ce_if),
         .rom(rom),
         .stall(stall),
-        .branch_taken_ex(branch_taken_branched),
-        .branch_target_ex(branch_target_branched),
+        .instruction_request_ready_if(instruction_request_ready_if),
+        .instruction_response_valid_if(instruction_response_valid_if),
+        .instruction_response_data_if(instruction_response_data_if),
+        .branch_taken_ex((branch_taken_branched || cop0_redirect) && ce),
+        .branch_target_ex(cop0_redirect ? cop0_target : branch_target_branched),
+        .branch_thread_ex(thread_id),
+        .branch_pc_ex(pc_id),
+        .flush_if(flush_if),
 
+        .thread_wb(thread_wb),
         .rd_wb(rd_wb),
         .rd_address_wb(rd_address_wb),
         .rd_data_wb(rd_data_wb),
 
+        .lane1_rd_wb(lane1_rd_wb),
+        .lane1_rd_address_wb(lane1_rd_address_wb),
+        .lane1_rd_data_wb(lane1_rd_data_wb),
+
+        .valid_if(valid_if),
+        .squash_if(squash_if),
+        .valid_id(valid_id),
+        .thread_id(thread_id),
         .pc_id(pc_id),
 
-        .rs_id(rs_id),
-        .rs_address_id(rs_address_id),
-        .rs_data_id(rs_data_id),
-        .rt_id(rt_id),
-        .rt_address_id(rt_address_id),
-        .rt_data_id(rt_data_id),
-        .rd_id(rd_id),
-        .rd_address_id(rd_address_id),
-
-        .shamt_id(shamt_id),
-        .shamt_value_id(shamt_value_id),
-        .imm_id(imm_id),
-        .imm_value_id(imm_value_id),
-        .target_id(target_id),
-        .target_value_id(target_value_id),
-
-        .alu_mode_id(alu_mode_id),
-        .alu_mode_value_id(alu_mode_value_id),
-
-        .link_id(link_id),
-        .branch_id(branch_id),
-        .branch_mode_id(branch_mode_id),
-        .jump_id(jump_id),
-
-        .lui_id(lui_id),
-        .load_id(load_id),
-        .load_sign_extend_id(load_sign_extend_id),
-        .load_store_data_size_mode_id(load_store_data_size_mode_id),
-        .store_id(store_id),
+        .control_id (control_id),
+        .rs_data_id (rs_data_id),
+        .rt_data_id (rt_data_id),
+
+        .lane1_valid_id   (lane1_valid_id  ),
+        .lane1_pc_id      (lane1_pc_id     ),
+        .lane1_control_id (lane1_control_id),
+        .lane1_rs_data_id (lane1_rs_data_id),
+        .lane1_rt_data_id (lane1_rt_data_id),
+
+        .rom_read_if(rom_read_if),
+        .instruction_request_valid_if(instruction_request_valid_if),
+        .instruction_request_address_if(instruction_request_address_if),
+        .prefetch_issued_if(prefetch_issued_if),
+        .prefetch_used_if(prefetch_used_if),
+        .prefetch_discarded_if(prefetch_discarded_if),
         .reg_file(reg_file)
     );
 
     logic [Constants::WIDTH-1:0] imm_value_extended;
     imm_extender imm_extender_inst (
-        .imm                (imm_id       ),
-        .imm_value          (imm_value_id ),
-        .shamt              (shamt_id     ),
-        .shamt_value        (shamt_value_id),
-        .alu_mode           (alu_mode_id  ),
-        .alu_mode_value     (alu_mode_value_id),
-        .load               (load_id),
-        .store              (store_id),
-        .branch             (branch_id),
-        .imm_value_extended (imm_value_extended)
+        .imm                (control_id.IMM        ),
+        .imm_value          (control_id.IMM_VALUE  ),
+        .shamt              (control_id.SHAMT      ),
+        .shamt_value        (control_id.SHAMT_VALUE),
+        .alu_select         (control_id.ALU_SELECT ),
+        .branch             (control_id.BRANCH     ),
+        .imm_value_extended (imm_value_extended    )
     );
 
-    logic [2-1:0] forwarder_a_selector;
+    logic [3-1:0] forwarder_a_selector;
     forwarding_unit forwarding_unit_a (
-        .r                   (rs_id          ),
-        .r_address           (rs_address_id  ),
-        .rd_ex         (rd_ex         ),
-        .rd_address_ex (rd_address_ex ),
-        .rd_wb               (rd_wb               ),
-        .rd_address_wb       (rd_address_wb       ),
-        .selector            (forwarder_a_selector)
+        .thread              (thread_id                  ),
+        .r                   (control_id.RS              ),
+        .r_address           (control_id.RS_ADDRESS      ),
+        .thread_ex           (thread_ex                  ),
+        .rd_ex               (control_ex.RD              ),
+        .rd_address_ex       (control_ex.RD_ADDRESS      ),
+        .thread_wb           (thread_wb                  ),
+        .rd_wb               (rd_wb                      ),
+        .rd_address_wb       (rd_address_wb              ),
+        .lane1_rd_ex         (lane1_control_ex.RD        ),
+        .lane1_rd_address_ex (lane1_control_ex.RD_ADDRESS),
+        .lane1_rd_wb         (lane1_rd_wb                ),
+        .lane1_rd_address_wb (lane1_rd_address_wb        ),
+        .selector            (forwarder_a_selector       )
     );
     logic [Constants::WIDTH-1:0] rs_data_forwarded;
     register_forwarder register_forwarder_a (
         .r_data_id      (rs_data_id     ),
         .alu_result_ex (alu_result_ex ),
         .rd_data_wb          (rd_data_wb          ),
+        .lane1_alu_result_ex (lane1_alu_result_ex ),
+        .lane1_rd_data_wb    (lane1_rd_data_wb    ),
         .selector            (forwarder_a_selector),
         .r_data_forwarded    (rs_data_forwarded   )
     );
 
-    logic [2-1:0] forwarder_b_selector;
+    logic [3-1:0] forwarder_b_selector;
     forwarding_unit forwarding_unit_b (
-        .r                   (rt_id          ),
-        .r_address           (rt_address_id  ),
-        .rd_ex               (rd_ex          ),
-        .rd_address_ex       (rd_address_ex  ),
-        .rd_wb               (rd_wb               ),
-        .rd_address_wb       (rd_address_wb       ),
-        .selector            (forwarder_b_selector)
+        .thread              (thread_id                  ),
+        .r                   (control_id.RT              ),
+        .r_address           (control_id.RT_ADDRESS      ),
+        .thread_ex           (thread_ex                  ),
+        .rd_ex               (control_ex.RD              ),
+        .rd_address_ex       (control_ex.RD_ADDRESS      ),
+        .thread_wb           (thread_wb                  ),
+        .rd_wb               (rd_wb                      ),
+        .rd_address_wb       (rd_address_wb              ),
+        .lane1_rd_ex         (lane1_control_ex.RD        ),
+        .lane1_rd_address_ex (lane1_control_ex.RD_ADDRESS),
+        .lane1_rd_wb         (lane1_rd_wb                ),
+        .lane1_rd_address_wb (lane1_rd_address_wb        ),
+        .selector            (forwarder_b_selector       )
     );
     logic [Constants::WIDTH-1:0] rt_data_forwarded;
     register_forwarder register_forwarder_b (
         .r_data_id      (rt_data_id     ),
         .alu_result_ex  (alu_result_ex  ),
         .rd_data_wb          (rd_data_wb          ),
+        .lane1_alu_result_ex (lane1_alu_result_ex ),
+        .lane1_rd_data_wb    (lane1_rd_data_wb    ),
         .selector            (forwarder_b_selector),
         .r_data_forwarded    (rt_data_forwarded   )
     );
     logic [Constants::WIDTH-1:0] alu_b;
     alu_register_imm_mux alu_register_imm_mux_inst (
-        .imm                (imm_id       ),
-        .shamt              (shamt_id     ),
-        .branch             (branch_id    ),
+        .imm                (control_id.IMM    ),
+        .shamt              (control_id.SHAMT  ),
+        .branch             (control_id.BRANCH ),
         .rt_data_forwarded  (rt_data_forwarded ),
         .imm_value_extended (imm_value_extended),
         .alu_b              (alu_b             )
@@ -453,74 +869,367 @@ module execute (
 
     logic [Constants::WIDTH-1:0] alu_result;
     logic                        alu_branch_result;
+    logic                        alu_overflow;
+    logic                        alu_move_failed;
     alu alu_inst (
-        .a              (rs_data_forwarded),
-        .b              (alu_b            ),
-        .pc             (pc_id       ),
-        .link           (link_id     ),
-        .alu_mode       (alu_mode_id ),
-        .alu_mode_value (alu_mode_value_id),
-        .branch         (branch_id   ),
-        .branch_mode    (branch_mode_id),
-        .lui            (lui_id      ),
-        .load           (load_id     ),
-        .store          (store_id    ),
+        .a             (rs_data_forwarded       ),
+        .b             (alu_b                   ),
+        .pc            (pc_id                   ),
+        .select        (control_id.ALU_SELECT   ),
+        .branch_select (control_id.BRANCH_SELECT),
         .
         result (alu_result),
-        .branch_result (alu_branch_result)
+        .branch_result (alu_branch_result),
+        .overflow      (alu_overflow     ),
+        .move_failed   (alu_move_failed  )
     );
 
     logic rd_branched;
     brancher brancher_inst (
-        .pc                       (pc_id        ),
-        .branch                   (branch_id    ),
-        .branch_comparison_result (alu_branch_result ),
-        .link                     (link_id      ),
-        .jump                     (jump_id      ),
-        .target                   (target_id    ),
-        .target_value             (target_value_id),
-        .rs                       (rs_id        ),
-        .rs_data                  (rs_data_forwarded ),
-        .imm                      (imm_id       ),
-        .imm_value                (imm_value_extended),
-        .rd                       (rd_id        ),
+        .pc                       (pc_id                  ),
+        .branch                   (control_id.BRANCH      ),
+        .branch_comparison_result (alu_branch_result      ),
+        .link                     (control_id.LINK        ),
+        .jump                     (control_id.JUMP        ),
+        .target                   (control_id.TARGET      ),
+        .target_value             (control_id.TARGET_VALUE),
+        .rs                       (control_id.RS          ),
+        .rs_data                  (rs_data_forwarded      ),
+        .imm                      (control_id.IMM         ),
+        .imm_value                (imm_value_extended     ),
+        .rd                       (control_id.RD          ),
         .
         branch_taken   (branch_taken_branched ),
         .branch_target (branch_target_branched),
         .rd_branched   (rd_branched           )
     );
 
-    execute_buffer execute_buffer_inst (
-        .clk  (clk ),
-        .nrst (nrst),
-        .
-        pc_in          (pc_id      ),
-        .alu_mode_in   (alu_mode_id),
-        .alu_result_in (alu_result ),
+    logic trap_overflow;
+    always_comb begin
+        trap_overflow = alu_overflow && control_id.TRAP;
+    end
+
+    logic                        cop0_exception    ;
+    logic [Constants::WIDTH-1:0] cop0_read_data    ;
+    logic                        interrupts_enabled;
+    if (CP0 && (THREAD_COUNT == 1) && (ISSUE_WIDTH == 1)) begin : cop0
+        coprocessor0 coprocessor0_inst (
+            .clk  (clk ),
+            .nrst (nrst),
+            .ce   (ce  ),
+            .
+            valid                      (valid_id                            ),
+            .pc                        (pc_id                               ),
+            .branch                    (control_id.BRANCH || control_id.JUMP),
+            .select                    (control_id.COP0_SELECT              ),
+            .write_data                (rt_data_forwarded                   ),
+            .overflow                  (trap_overflow                       ),
+            .load                      (control_id.LOAD                     ),
+            .store                     (control_id.STORE                    ),
+            .load_store_data_size_mode (control_id.LOAD_STORE_DATA_SIZE_MODE),
+            .address                   (alu_result                          ),
+            .interrupts                (interrupts                          ),
+            .
+            read_data           (cop0_read_data    ),
+            .exception          (cop0_exception    ),
+            .redirect           (cop0_redirect     ),
+            .target             (cop0_target       ),
+            .interrupts_enabled (interrupts_enabled)
+        );
+    end else begin : no_cop0
+        always_comb begin
+            cop0_read_data     = 0;
+            cop0_exception     = 0;
+            cop0_redirect      = 0;
+            cop0_target        = 0;
+            interrupts_enabled = 0;
+        end
+    end
+
+    always_comb begin
+        cop0_exception_ex = cop0_exception;
+        cop0_redirect_ex  = cop0_redirect;
+    end
+
+    logic [Constants::WIDTH-1:0] mac_read_data;
+    if (MULTIPLY_ACCUMULATE) begin : mac
+        multiply_accumulate #(
+            .THREAD_COUNT(THREAD_COUNT)
+        ) multiply_accumulate_inst (
+            .clk  (clk ),
+            .nrst (nrst),
+            .ce   (ce  ),
+            .
+            valid   (valid_id && !cop0_exception),
+            .thread (thread_id                  ),
+            .select (control_id.MAC_SELECT      ),
+            .a      (rs_data_forwarded          ),
+            .b      (rt_data_forwarded          ),
+            .
+            busy       (mac_busy_ex  ),
+            .read_data (mac_read_data)
+        );
+    end else begin : no_mac
+        always_comb begin
+            mac_busy_ex   = 0;
+            mac_read_data = 0;
+        end
+    end
+
+    logic [Constants::WIDTH-1:0] accelerator_result;
+    if (ACCELERATOR) begin : accelerator
+        logic                        request_valid   ;
+        logic                        request_ready   ;
+        logic [4-1:0]                request_function;
+        logic [Constants::WIDTH-1:0] request_a       ;
+        logic [Constants::WIDTH-1:0] request_b       ;
+        logic                        response_valid  ;
+        logic                        response_ready  ;
+        logic [Constants::WIDTH-1:0] response_data   ;
+
+        accelerator_port accelerator_port_inst (
+            .clk  (clk ),
+            .nrst (nrst),
+            .ce   (ce  ),
+            .
+            valid      (valid_id                ),
+            .select    (control_id.CUSTOM_SELECT),
+            .exception (cop0_exception          ),
+            .a         (rs_data_forwarded       ),
+            .b         (rt_data_forwarded       ),
+            .
+            busy    (accelerator_busy_ex),
+            .result (accelerator_result ),
+            .
+            request_valid     (request_valid   ),
+            .request_ready    (request_ready   ),
+            .request_function (request_function),
+            .request_a        (request_a       ),
+            .request_b        (request_b       ),
+            .response_valid   (response_valid  ),
+            .response_ready   (response_ready  ),
+            .response_data    (response_data   )
+        );
+
+        // Clocked without the core clock enable, it has to finish while the
+        // core is held for it.
+        byte_sort_accelerator byte_sort_accelerator_inst (
+            .clk  (clk ),
+            .nrst (nrst),
+            .
+            request_valid     (request_valid   ),
+            .request_ready    (request_ready   ),
+            .request_function (request_function),
+            .request_a        (request_a       ),
+            .request_b        (request_b       ),
+            .response_valid   (response_valid  ),
+            .response_ready   (response_ready  ),
+            .response_data    (response_data   )
+        );
+    end else begin : no_accelerator
+        always_comb begin
+            accelerator_busy_ex = 0;
+            accelerator_result  = 0;
+        end
+    end
+
+    logic [Constants::WIDTH-1:0] result;
+    always_comb begin
+        if (control_id.COP0_SELECT.MFC0) begin
+            result = cop0_read_data;
+        end else if (control_id.MAC_SELECT.MFHI || control_id.MAC_SELECT.MFLO) begin
+            result = mac_read_data;
+        end else if (control_id.CUSTOM_SELECT.CUSTOM) begin
+            result = accelerator_result;
+        end else begin
+            result = alu_result;
+        end
+    end
+
+    // A loop waiting for an interrupt is not idle.
+    idle_detector #(
+        .THREAD_COUNT(THREAD_COUNT)
+    ) idle_detector_inst (
+        .clk   (clk                        ),
+        .nrst  (nrst                       ),
+        .ce    (ce                         ),
+        .stall (stall || interrupts_enabled),
         .
-        rt_data_in (rt_data_forwarded),
+        valid          (valid_id              ),
+        .thread        (thread_id             ),
+        .pc            (pc_id                 ),
+        .branch_taken  (branch_taken_branched ),
+        .branch_target (branch_target_branched),
+        .rd            (rd_branched           ),
+        .rd_address    (control_id.RD_ADDRESS ),
+        .store         (control_id.STORE      ),
+        .load          (control_id.LOAD       ),
+        .cop0_select   (control_id.COP0_SELECT),
+        .mac_select    (control_id.MAC_SELECT ),
+        .custom_select (control_id.CUSTOM_SELECT),
         .
-        rd_in          (rd_branched),
-        .rd_address_in (rd_address_id),
+        idle (idle_ex)
+    );
+
+    logic [Constants::WIDTH-1:0] lane1_imm_value_extended;
+    imm_extender lane1_imm_extender_inst (
+        .imm                (lane1_control_id.IMM        ),
+        .imm_value          (lane1_control_id.IMM_VALUE  ),
+        .shamt              (lane1_control_id.SHAMT      ),
+        .shamt_value        (lane1_control_id.SHAMT_VALUE),
+        .alu_select         (lane1_control_id.ALU_SELECT ),
+        .branch             (1'b0                        ),
+        .imm_value_extended (lane1_imm_value_extended    )
+    );
+
+    logic [3-1:0] lane1_forwarder_a_selector;
+    forwarding_unit lane1_forwarding_unit_a (
+        .thread              (thread_id                  ),
+        .r                   (lane1_control_id.RS        ),
+        .r_address           (lane1_control_id.RS_ADDRESS),
+        .thread_ex           (thread_ex                  ),
+        .rd_ex               (control_ex.RD              ),
+        .rd_address_ex       (control_ex.RD_ADDRESS      ),
+        .thread_wb           (thread_wb                  ),
+        .rd_wb               (rd_wb                      ),
+        .rd_address_wb       (rd_address_wb              ),
+        .lane1_rd_ex         (lane1_control_ex.RD        ),
+        .lane1_rd_address_ex (lane1_control_ex.RD_ADDRESS),
+        .lane1_rd_wb         (lane1_rd_wb                ),
+        .lane1_rd_address_wb (lane1_rd_address_wb        ),
+        .selector            (lane1_forwarder_a_selector )
+    );
+    logic [Constants::WIDTH-1:0] lane1_rs_data_forwarded;
+    register_forwarder lane1_register_forwarder_a (
+        .r_data_id           (lane1_rs_data_id          ),
+        .alu_result_ex       (alu_result_ex             ),
+        .rd_data_wb          (rd_data_wb                ),
+        .lane1_alu_result_ex (lane1_alu_result_ex       ),
+        .lane1_rd_data_wb    (lane1_rd_data_wb          ),
+        .selector            (lane1_forwarder_a_selector),
+        .r_data_forwarded    (lane1_rs_data_forwarded   )
+    );
+
+    logic [3-1:0] lane1_forwarder_b_selector;
+    forwarding_unit lane1_forwarding_unit_b (
+        .thread              (thread_id                  ),
+        .r                   (lane1_control_id.RT        ),
+        .r_address           (lane1_control_id.RT_ADDRESS),
+        .thread_ex           (thread_ex                  ),
+        .rd_ex               (control_ex.RD              ),
+        .rd_address_ex       (control_ex.RD_ADDRESS      ),
+        .thread_wb           (thread_wb                  ),
+        .rd_wb               (rd_wb                      ),
+        .rd_address_wb       (rd_address_wb              ),
+        .lane1_rd_ex         (lane1_control_ex.RD        ),
+        .lane1_rd_address_ex (lane1_control_ex.RD_ADDRESS),
+        .lane1_rd_wb         (lane1_rd_wb                ),
+        .lane1_rd_address_wb (lane1_rd_address_wb        ),
+        .selector            (lane1_forwarder_b_selector )
+    );
+    logic [Constants::WIDTH-1:0] lane1_rt_data_forwarded;
+    register_forwarder lane1_register_forwarder_b (
+        .r_data_id           (lane1_rt_data_id          ),
+        .alu_result_ex       (alu_result_ex             ),
+        .rd_data_wb          (rd_data_wb                ),
+        .lane1_alu_result_ex (lane1_alu_result_ex       ),
+        .lane1_rd_data_wb    (lane1_rd_data_wb          ),
+        .selector            (lane1_forwarder_b_selector),
+        .r_data_forwarded    (lane1_rt_data_forwarded   )
+    );
+
+    logic [Constants::WIDTH-1:0] lane1_alu_b;
+    alu_register_imm_mux lane1_alu_register_imm_mux_inst (
+        .imm                (lane1_control_id.IMM    ),
+        .shamt              (lane1_control_id.SHAMT  ),
+        .branch             (1'b0                    ),
+        .rt_data_forwarded  (lane1_rt_data_forwarded ),
+        .imm_value_extended (lane1_imm_value_extended),
+        .alu_b              (lane1_alu_b             )
+    );
+
+    logic [Constants::WIDTH-1:0] lane1_alu_result;
+    logic                        lane1_alu_branch_result;
+    logic                        lane1_alu_overflow;
+    logic                        lane1_alu_move_failed;
+    alu lane1_alu_inst (
+        .a             (lane1_rs_data_forwarded    ),
+        .b             (lane1_alu_b                ),
+        .pc            (lane1_pc_id                ),
+        .select        (lane1_control_id.ALU_SELECT),
+        .branch_select ('0                         ),
         .
-        load_in                       (load_id),
-        .load_store_data_size_mode_in (load_store_data_size_mode_id),
-        .load_sign_extend_in          (load_sign_extend_id),
-        .store_in                     (store_id),
+        result (lane1_alu_result),
+        .branch_result (lane1_alu_branch_result),
+        .overflow      (lane1_alu_overflow     ),
+        .move_failed   (lane1_alu_move_failed  )
+    );
+
+    // Only the fields memory and writeback read go on, the rest of the word is
+    // constant and its flops prune away. An instruction flushed by the hazard
+    // controller goes on as a bubble.
+    Decode::Control control;
+    always_comb begin
+        control                           = 0;
+        control.RD                        = rd_branched && !alu_move_failed && !flush_id;
+        control.RD_ADDRESS                = control_id.RD_ADDRESS;
+        control.ALU_MODE                  = control_id.ALU_MODE;
+        control.LOAD                      = control_id.LOAD && !flush_id;
+        control.LOAD_SIGN_EXTEND          = control_id.LOAD_SIGN_EXTEND;
+        control.LOAD_STORE_DATA_SIZE_MODE = control_id.LOAD_STORE_DATA_SIZE_MODE;
+        control.STORE                     = control_id.STORE && !flush_id;
+        control.LOAD_LINKED               = control_id.LOAD_LINKED && !flush_id;
+        control.STORE_CONDITIONAL         = control_id.STORE_CONDITIONAL && !flush_id;
+    end
 
+    execute_buffer execute_buffer_inst (
+        .clk  (clk ),
+        .nrst (nrst),
+        .ce   (ce  ),
         .
-        pc_out          (pc_ex        ),
-        .alu_mode_out   (alu_mode_ex  ),
-        .alu_result_out (alu_result_ex),
+        valid_in       (valid_id && !flush_id),
+        .thread_in     (thread_id            ),
+        .pc_in         (pc_id                ),
+        .control_in    (control              ),
+        .alu_result_in (result               ),
+        .rt_data_in    (rt_data_forwarded    ),
         .
-        rt_data_out (rt_data_ex),
+        valid_out       (valid_ex     ),
+        .thread_out     (thread_ex    ),
+        .pc_out         (pc_ex        ),
+        .control_out    (control_ex   ),
+        .alu_result_out (alu_result_ex),
+        .rt_data_out    (rt_data_ex   )
+    );
+
+    Decode::Control lane1_control;
+    always_comb begin
+        lane1_control            = 0;
+        lane1_control.RD         = lane1_control_id.RD && !lane1_alu_move_failed;
+        lane1_control.RD_ADDRESS = lane1_control_id.RD_ADDRESS;
+        lane1_control.ALU_MODE   = lane1_control_id.ALU_MODE;
+    end
+
+    logic [Constants::THREAD_ID_WIDTH-1:0] lane1_thread_ex ;
+    logic [Constants::WIDTH-1:0]           lane1_rt_data_ex;
+
+    execute_buffer lane1_execute_buffer_inst (
+        .clk  (clk ),
+        .nrst (nrst),
+        .ce   (ce  ),
         .
-        rd_out          (rd_ex        ),
-        .rd_address_out (rd_address_ex),
+        valid_in       (lane1_valid_id         ),
+        .thread_in     (thread_id              ),
+        .pc_in         (lane1_pc_id            ),
+        .control_in    (lane1_control          ),
+        .alu_result_in (lane1_alu_result       ),
+        .rt_data_in    (lane1_rt_data_forwarded),
         .
-        load_out                       (load_ex                     ),
-        .load_store_data_size_mode_out (load_store_data_size_mode_ex),
-        .load_sign_extend_out          (load_sign_extend_ex         ),
-        .store_out                     (store_ex                    )
+        valid_out       (lane1_valid_ex     ),
+        .thread_out     (lane1_thread_ex    ),
+        .pc_out         (lane1_pc_ex        ),
+        .control_out    (lane1_control_ex   ),
+        .alu_result_out (lane1_alu_result_ex),
+        .rt_data_out    (lane1_rt_data_ex   )
     );
 endmodule
\ No newline at end of file
@@ -2,35 +2,370 @@ package Fetch;
     localparam logic [Constants::WIDTH-1:0] PC_RESET_VALUE = 32'hffff_fffc;
 endpackage
 
-module pc_register (
-    input  var logic                        clk   ,
-    input  var logic                        nrst  ,
-    input  var logic [Constants::WIDTH-1:0] pc_in ,
-    output var logic [Constants::WIDTH-1:0] pc_out
+module pc_register #(
+    parameter int unsigned THREAD_COUNT  = 1,
+    parameter bit          HOLD_REDIRECT = 0
+) (
+    input  var logic                                  clk             ,
+    input  var logic                                  nrst            ,
+    input  var logic                                  ce              ,
+    input  var logic                                  stall           ,
+    input  var logic                                  branch_taken_ex ,
+    input  var logic [Constants::WIDTH-1:0]           branch_target_ex,
+    input  var logic [Constants::THREAD_ID_WIDTH-1:0] branch_thread_ex,
+    input  var logic                                  delay_slot_fetched,
+    input  var logic                                  jump_if         ,
+    input  var logic [Constants::WIDTH-1:0]           jump_target_if  ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread          ,
+    output var logic [Constants::WIDTH-1:0]           pc
 );
+    // Every thread keeps the address it fetches next and the one after it, so
+    // a branch resolved before its delay slot was fetched only replaces the
+    // latter. A single thread fetches the target in the same cycle instead,
+    // with HOLD_REDIRECT a stalled fetch keeps the target to fetch it later.
+    logic [Constants::WIDTH-1:0] pcs  [0:THREAD_COUNT-1];
+    logic [Constants::WIDTH-1:0] npcs [0:THREAD_COUNT-1];
+
+    always_comb begin
+        pc = pcs[thread];
+    end
+
     always_ff @ (posedge clk, negedge nrst) begin
         if (!nrst) begin
-            pc_out <= 0;
-        end else begin
-            pc_out <= pc_in;
+            thread <= 0;
+            for (int unsigned i = 0; i < THREAD_COUNT; i++) begin
+                pcs[i]  <= 0;
+                npcs[i] <= 4;
+            end
+        end else if (ce) begin
+            if (!stall) begin
+                thread       <= $bits(thread)'((thread + 1) % THREAD_COUNT);
+                pcs[thread]  <= npcs[thread];
+                npcs[thread] <= npcs[thread] + 4;
+            end
+            if ((THREAD_COUNT == 1) && jump_if) begin
+                if (!stall) begin
+                    pcs[0]  <= jump_target_if;
+                    npcs[0] <= jump_target_if + 4;
+                end else begin
+                    npcs[0] <= jump_target_if;
+                end
+            end
+            if (branch_taken_ex) begin
+                if ((THREAD_COUNT == 1) && !delay_slot_fetched && stall) begin
+                    npcs[0] <= branch_target_ex;
+                end else if ((THREAD_COUNT == 1) && (!delay_slot_fetched || (HOLD_REDIRECT && stall))) begin
+                    pcs[0]  <= branch_target_ex;
+                    npcs[0] <= branch_target_ex + 4;
+                end else if (THREAD_COUNT == 1) begin
+                    pcs[0]  <= branch_target_ex + 4;
+                    npcs[0] <= branch_target_ex + 8;
+                end else if ((branch_thread_ex == thread) && !stall) begin
+                    pcs[branch_thread_ex]  <= branch_target_ex;
+                    npcs[branch_thread_ex] <= branch_target_ex + 4;
+                end else begin
+                    npcs[branch_thread_ex] <= branch_target_ex;
+                end
+            end
+        end
+    end
+endmodule
+
+// j, jal and b (beq $0, $0) are always taken and their target only depends on
+// the instruction, so fetch can follow them while their delay slot is fetched.
+module jump_predecoder (
+    input  var logic                        valid      ,
+    input  var logic [Constants::WIDTH-1:0] pc         ,
+    input  var logic [Constants::WIDTH-1:0] instruction,
+    output var logic                        jump       ,
+    output var logic [Constants::WIDTH-1:0] target
+);
+    logic [Constants::WIDTH-1:0] pc_plus_4;
+    always_comb begin
+        pc_plus_4 = pc + 4;
+    end
+
+    always_comb begin
+        jump   = 0;
+        target = 0;
+        if (valid) begin
+            if (instruction[31:27] == 5'b00001) begin
+                jump   = 1;
+                // the region of a j/jal is the one of its delay slot
+                target = {pc_plus_4[31:28], instruction[25:0], 2'b00};
+            end
+            if (instruction[31:16] == 16'b000100_00000_00000) begin
+                jump   = 1;
+                target = pc_plus_4 + {{14{instruction[15]}}, instruction[15:0], 2'b00};
+            end
         end
     end
 endmodule
 
-module pc_advancer (
-    input  var logic [Constants::WIDTH-1:0] pc_in        ,
-    input  var logic                        stall        ,
+// Holds the body of the last short backward loop, from the branch target up
+// to the delay slot. Words are filled as they are fetched and replayed from
+// then on, a taken branch outside of the window starts over with a new one.
+// The branch is only looked at as it leaves EX on ce_core, filling follows
+// fetch on ce.
+module loop_buffer #(
+    parameter int unsigned SIZE = 16
+) (
+    input  var logic clk    ,
+    input  var logic nrst   ,
+    input  var logic ce     ,
+    input  var logic ce_core,
+
     input  var logic                        branch_taken_ex ,
+    input  var logic [Constants::WIDTH-1:0] branch_pc_ex    ,
     input  var logic [Constants::WIDTH-1:0] branch_target_ex,
-    output var logic [Constants::WIDTH-1:0] pc_out   
+
+    input  var logic [Constants::WIDTH-1:0] address  ,
+    input  var logic                        rom_valid,
+    input  var logic [Constants::WIDTH-1:0] rom_word ,
+
+    output var logic                        hit   ,
+    output var logic [Constants::WIDTH-1:0] word  ,
+    output var logic                        active,
+    output var logic [Constants::WIDTH-1:0] start ,
+    output var logic [Constants::WIDTH-1:0] last
 );
+    logic [Constants::WIDTH-1:0] words  [0:SIZE-1];
+    logic                        filled [0:SIZE-1];
+
+    logic                        capture;
+    logic                        inside ;
+    logic [Constants::WIDTH-1:0] index  ;
     always_comb begin
-        if (branch_taken_ex) begin
-            pc_out = branch_target_ex + 4;
-        end else if (stall) begin
-            pc_out = pc_in;
+        capture = (
+            branch_taken_ex
+            && (branch_target_ex <= branch_pc_ex)
+            && ((branch_pc_ex + 4 - branch_target_ex) < (SIZE * 4))
+            && !(active && (start == branch_target_ex) && (last == branch_pc_ex + 4))
+        );
+        inside = active && (address >= start) && (address <= last);
+        index  = (address - start) >> 2;
+        hit    = inside && filled[index];
+        word   = words[index];
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            active <= 0;
+            start  <= 0;
+            last   <= 0;
+            for (int unsigned i = 0; i < SIZE; i++) begin
+                words[i]  <= 0;
+                filled[i] <= 0;
+            end
         end else begin
-            pc_out = pc_in + 4;
+            if (ce_core && capture) begin
+                active <= 1;
+                start  <= branch_target_ex;
+                last   <= branch_pc_ex + 4;
+                for (int unsigned i = 0; i < SIZE; i++) begin
+                    filled[i] <= 0;
+                end
+            end else if (ce && inside && !filled[index] && rom_valid) begin
+                filled[index] <= 1;
+                words[index]  <= rom_word;
+            end
+        end
+    end
+endmodule
+
+// Fetches over a request/response port instead of the ROM array, with one
+// request in flight. A response fetch cannot take yet is held until it can, a
+// response for an address fetch has moved away from is dropped.
+module instruction_port (
+    input  var logic clk ,
+    input  var logic nrst,
+    input  var logic ce  ,
+
+    input  var logic                        stall  ,
+    input  var logic                        skip   ,
+    input  var logic [Constants::WIDTH-1:0] address,
+
+    output var logic                        hit ,
+    output var logic [Constants::WIDTH-1:0] word,
+
+    output var logic                        request_valid  ,
+    output var logic [Constants::WIDTH-1:0] request_address,
+    input  var logic                        request_ready  ,
+    input  var logic                        response_valid ,
+    input  var logic [Constants::WIDTH-1:0] response_data
+);
+    logic                        outstanding        ;
+    logic [Constants::WIDTH-1:0] outstanding_address;
+    logic                        held               ;
+    logic [Constants::WIDTH-1:0] held_address       ;
+    logic [Constants::WIDTH-1:0] held_word          ;
+
+    logic held_hit;
+    logic arrived ;
+    always_comb begin
+        held_hit        = held && (held_address == address);
+        arrived         = outstanding && response_valid && (outstanding_address == address);
+        hit             = held_hit || arrived;
+        word            = held_hit ? held_word : response_data;
+        request_valid   = !outstanding && !held && !skip;
+        request_address = address;
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            outstanding         <= 0;
+            outstanding_address <= 0;
+            held                <= 0;
+            held_address        <= 0;
+            held_word           <= 0;
+        end else begin
+            if (request_valid && request_ready) begin
+                outstanding         <= 1;
+                outstanding_address <= address;
+            end else if (outstanding && response_valid) begin
+                outstanding <= 0;
+            end
+
+            if ((ce && !stall && hit) || (held && !held_hit)) begin
+                held <= 0;
+            end else if (outstanding && response_valid) begin
+                held         <= 1;
+                held_address <= outstanding_address;
+                held_word    <= response_data;
+            end
+        end
+    end
+endmodule
+
+// Fetches over the same request/response port as instruction_port, but keeps
+// streaming the words behind the fetch address with up to DEPTH requests
+// outstanding or answered and not yet taken. Fetch takes its word from the
+// head when the address matches, any other address restarts the stream there
+// and the responses still due for the old one are dropped as they arrive.
+// cancel stops the stream at the current address, the delay slot of a taken
+// branch is the last word fetched on this path.
+module prefetcher #(
+    parameter int unsigned DEPTH = 4
+) (
+    input  var logic clk ,
+    input  var logic nrst,
+    input  var logic ce  ,
+
+    input  var logic                        stall  ,
+    input  var logic                        skip   ,
+    input  var logic                        cancel ,
+    input  var logic [Constants::WIDTH-1:0] address,
+
+    output var logic                        hit      ,
+    output var logic [Constants::WIDTH-1:0] word     ,
+    output var logic [Constants::WIDTH-1:0] issued   ,
+    output var logic [Constants::WIDTH-1:0] used     ,
+    output var logic [Constants::WIDTH-1:0] discarded,
+
+    output var logic                        request_valid  ,
+    output var logic [Constants::WIDTH-1:0] request_address,
+    input  var logic                        request_ready  ,
+    input  var logic                        response_valid ,
+    input  var logic [Constants::WIDTH-1:0] response_data
+);
+    // The stream is kept in order, the first arrived entries have their word.
+    logic [Constants::WIDTH-1:0] addresses  [0:DEPTH-1];
+    logic [Constants::WIDTH-1:0] words      [0:DEPTH-1];
+    logic                        prefetched [0:DEPTH-1];
+    logic [Constants::WIDTH-1:0] count       ;
+    logic [Constants::WIDTH-1:0] arrived     ;
+    logic [Constants::WIDTH-1:0] dropped     ;
+    logic [Constants::WIDTH-1:0] next_address;
+    logic                        stopped     ;
+    logic [Constants::WIDTH-1:0] stop_address;
+
+    logic                        answered      ;
+    logic                        restart       ;
+    logic                        use_head      ;
+    logic                        halted        ;
+    logic [Constants::WIDTH-1:0] stream_address;
+    logic [Constants::WIDTH-1:0] stale         ;
+    logic                        accepted      ;
+    always_comb begin
+        answered = response_valid && (dropped == 0);
+        restart  = !((count != 0) && (addresses[0] == address));
+        hit      = !restart && ((arrived != 0) || answered);
+        word     = (arrived != 0) ? words[0] : response_data;
+        use_head = ce && !stall && hit;
+
+        // The request only depends on state, a slot freed by the word taken
+        // this cycle is refilled in the next one.
+        halted          = cancel || (stopped && (stop_address == address));
+        stream_address  = restart ? address : next_address;
+        request_valid   = !skip && (restart || (count < DEPTH)) && (!halted || (stream_address == address));
+        request_address = stream_address;
+        accepted        = request_valid && request_ready;
+
+        stale = 0;
+        for (int unsigned i = 0; i < DEPTH; i++) begin
+            if ((i < count) && prefetched[i]) begin
+                stale = stale + 1;
+            end
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            for (int unsigned i = 0; i < DEPTH; i++) begin
+                addresses[i]  <= 0;
+                words[i]      <= 0;
+                prefetched[i] <= 0;
+            end
+            count        <= 0;
+            arrived      <= 0;
+            dropped      <= 0;
+            next_address <= 0;
+            stopped      <= 0;
+            stop_address <= 0;
+            issued       <= 0;
+            used         <= 0;
+            discarded    <= 0;
+        end else begin
+            if (restart) begin
+                dropped   <= dropped + (count - arrived) - {31'b0, response_valid};
+                count     <= {31'b0, accepted};
+                arrived   <= 0;
+                discarded <= discarded + stale;
+                if (accepted) begin
+                    addresses[0]  <= address;
+                    prefetched[0] <= 0;
+                end
+            end else begin
+                if (use_head) begin
+                    for (int unsigned i = 0; i + 1 < DEPTH; i++) begin
+                        addresses[i]  <= addresses[i + 1];
+                        words[i]      <= words[i + 1];
+                        prefetched[i] <= prefetched[i + 1];
+                    end
+                end
+                if (answered && !(use_head && (arrived == 0))) begin
+                    words[arrived - {31'b0, use_head}] <= response_data;
+                end
+                if (accepted) begin
+                    addresses[count - {31'b0, use_head}]  <= next_address;
+                    prefetched[count - {31'b0, use_head}] <= 1;
+                end
+                dropped <= dropped - {31'b0, response_valid && (dropped != 0)};
+                count   <= count - {31'b0, use_head} + {31'b0, accepted};
+                arrived <= arrived - {31'b0, use_head} + {31'b0, answered};
+                issued  <= issued + {31'b0, accepted};
+                used    <= used + {31'b0, use_head && prefetched[0]};
+            end
+            if (accepted) begin
+                next_address <= stream_address + 4;
+            end
+
+            if (cancel) begin
+                stopped      <= 1;
+                stop_address <= address;
+            end else if (stop_address != address) begin
+                stopped <= 0;
+            end
         end
     end
 endmodule
@@ -64,78 +399,406 @@ endmodule
 module fetch_buffer (
     input  var logic                        clk            ,
     input  var logic                        nrst            ,
+    input  var logic                        ce             ,
     input  var logic                        stall          ,
     input  var logic [Constants::WIDTH-1:0] pc_in          ,
+    input  var logic [Constants::THREAD_ID_WIDTH-1:0] thread_in ,
     input  var logic                        branch_taken_ex   ,
     input  var logic [Constants::WIDTH-1:0] branch_target_ex  ,
     input  var logic [Constants::WIDTH-1:0] instruction_in ,
+    input  var logic [Constants::WIDTH-1:0] lane1_instruction_in,
+    output var logic                        valid_out      ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_out ,
     output var logic [Constants::WIDTH-1:0] pc_out         ,
-    output var logic [Constants::WIDTH-1:0] instruction_out
+    output var logic [Constants::WIDTH-1:0] instruction_out,
+    output var logic [Constants::WIDTH-1:0] lane1_instruction_out
 );
     always_ff @ (posedge clk, negedge nrst) begin
         if (!nrst) begin
+            valid_out       <= 0;
+            thread_out      <= 0;
             pc_out          <= Fetch::PC_RESET_VALUE;
             instruction_out <= 0;
-        end else if (stall) begin
-            pc_out          <= pc_in;
-            instruction_out <= 0;
-        end else begin
-            if (branch_taken_ex) begin
-                pc_out <= branch_target_ex;
-            end else begin
+            lane1_instruction_out <= 0;
+        end else if (ce) begin
+            valid_out  <= !stall;
+            thread_out <= thread_in;
+            if (stall) begin
                 pc_out <= pc_in;
+            end else begin
+                if (branch_taken_ex) begin
+                    pc_out <= branch_target_ex;
+                end else begin
+                    pc_out <= pc_in;
+                end
+                instruction_out <= instruction_in;
+                lane1_instruction_out <= lane1_instruction_in;
             end
-            instruction_out <= instruction_in;
         end
     end
 endmodule
 
-module fetch (
+module fetch #(
+    parameter int unsigned THREAD_COUNT        = 1,
+    parameter int unsigned ISSUE_WIDTH         = 1,
+    parameter bit          REGISTERED_REDIRECT = 0,
+    parameter int unsigned LOOP_BUFFER_SIZE    = 0,
+    parameter int unsigned PREFETCH_DEPTH      = 0,
+    parameter bit          EXTERNAL_MEMORY     = 0
+) (
     input  var logic                        clk                ,
     input  var logic                        nrst               ,
+    input  var logic                        ce                 ,
+    input  var logic                        ce_core            ,
     input  var logic [Constants::BYTE-1:0]  rom     [0:Constants::ROM_SIZE-1] ,
     input  var logic                        stall              ,
     input  var logic                        branch_taken_ex    ,
     input  var logic [Constants::WIDTH-1:0] branch_target_ex   ,
+    input  var logic [Constants::THREAD_ID_WIDTH-1:0] branch_thread_ex,
+    input  var logic [Constants::WIDTH-1:0] branch_pc_ex       ,
+    input  var logic                        flush_if           ,
+    input  var logic                        pair_id            ,
+    input  var logic                        instruction_request_ready_if ,
+    input  var logic                        instruction_response_valid_if,
+    input  var logic [Constants::WIDTH-1:0] instruction_response_data_if ,
+    output var logic                        instruction_request_valid_if  ,
+    output var logic [Constants::WIDTH-1:0] instruction_request_address_if,
+    output var logic                        valid_if      ,
+    output var logic                        squash_if     ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_if,
     output var logic [Constants::WIDTH-1:0] pc_if         ,
-    output var logic [Constants::WIDTH-1:0] instruction_if
+    output var logic [Constants::WIDTH-1:0] instruction_if,
+    output var logic [Constants::WIDTH-1:0] lane1_instruction_if,
+    output var logic                        rom_read_if,
+    output var logic [Constants::WIDTH-1:0] prefetch_issued_if   ,
+    output var logic [Constants::WIDTH-1:0] prefetch_used_if     ,
+    output var logic [Constants::WIDTH-1:0] prefetch_discarded_if
 );
-    logic [Constants::WIDTH-1:0] pc_advanced;
-    logic [Constants::WIDTH-1:0] pc         ;
-
-    pc_register pc_register_inst (
-        .clk    (clk        ),
-        .nrst   (nrst        ),
-        .pc_in  (pc_advanced),
-        .pc_out (pc         )
-    );
+    logic [Constants::THREAD_ID_WIDTH-1:0] thread   ;
+    logic [Constants::WIDTH-1:0]           pc       ;
+    logic                                  redirect ;
+    logic [Constants::WIDTH-1:0]           buffer_pc;
 
-    pc_advancer pc_advancer_inst (
-        .pc_in         (pc           ),
-        .stall         (stall        ),
-        .branch_taken_ex  (branch_taken_ex ),
-        .branch_target_ex (branch_target_ex),
-        .pc_out        (pc_advanced  )
-    );
+    // With EXTERNAL_MEMORY words come from the instruction port and fetch
+    // stalls until they arrive. A branch that resolves while its delay slot
+    // is still being fetched then only replaces the address behind it.
+    localparam bit EXTERNAL = EXTERNAL_MEMORY && (THREAD_COUNT == 1) && (ISSUE_WIDTH == 1) && !REGISTERED_REDIRECT;
+    logic                        fetch_stall       ;
+    logic                        delay_slot_fetched;
+    logic                        memory_hit        ;
+    logic [Constants::WIDTH-1:0] memory_word       ;
+    logic                        buffer_valid      ;
 
-    logic [Constants::WIDTH-1:0] instruction;
+    // The registered redirect takes the ALU and brancher out of the fetch
+    // path. The target is then fetched a cycle late, so the instruction
+    // fetched behind the delay slot is squashed on its way into decode.
+    // Jumps the pre-decoder already followed are not redirected again once
+    // they resolve in EX, and the closing branch of the loop in the loop
+    // buffer is predicted taken. Only a mispredicted loop exit or a different
+    // target redirects.
+    //
+    // The loop buffer captures the loop from the registered branch as well, a
+    // cycle late, so nothing in fetch looks at the branch in EX. The target
+    // word is then only filled on the second pass, the prediction of the
+    // closing branch is in place in time all the same.
+    //
+    // The registers below follow instructions from IF into EX and on, so they
+    // advance on ce_core. Fetch may run ahead on ce alone while the core
+    // waits, it then acts on the registered redirect once and the redirect is
+    // done until the core moves on.
+    logic                        branch_taken ;
+    logic [Constants::WIDTH-1:0] branch_target;
+    logic                        squash       ;
+    logic                        jump         ;
+    logic [Constants::WIDTH-1:0] jump_target  ;
+
+    logic                        loop_branch_taken ;
+    logic [Constants::WIDTH-1:0] loop_branch_pc    ;
+    logic [Constants::WIDTH-1:0] loop_branch_target;
+    logic                        loop_active;
+    logic [Constants::WIDTH-1:0] loop_start ;
+    logic [Constants::WIDTH-1:0] loop_last  ;
+    if (REGISTERED_REDIRECT && (THREAD_COUNT == 1)) begin : registered_redirect
+        logic                        registered_branch_taken ;
+        logic [Constants::WIDTH-1:0] registered_branch_pc    ;
+        logic [Constants::WIDTH-1:0] registered_branch_target;
+        logic                        jump_id       ;
+        logic                        jump_ex       ;
+        logic [Constants::WIDTH-1:0] jump_target_id;
+        logic [Constants::WIDTH-1:0] jump_target_ex;
+        logic [Constants::WIDTH-1:0] fallthrough_id;
+        logic [Constants::WIDTH-1:0] fallthrough_ex;
+        logic                        redirected    ;
+        always_ff @ (posedge clk, negedge nrst) begin
+            if (!nrst) begin
+                redirected               <= 0;
+                registered_branch_taken  <= 0;
+                registered_branch_pc     <= 0;
+                registered_branch_target <= 0;
+                jump_id                  <= 0;
+                jump_ex                  <= 0;
+                jump_target_id           <= 0;
+                jump_target_ex           <= 0;
+                fallthrough_id           <= 0;
+                fallthrough_ex           <= 0;
+            end else if (ce_core) begin
+                redirected               <= 0;
+                registered_branch_taken  <= branch_taken_ex;
+                registered_branch_pc     <= branch_pc_ex;
+                registered_branch_target <= branch_target_ex;
+                jump_id                  <= jump;
+                jump_ex                  <= jump_id;
+                jump_target_id           <= jump_target;
+                jump_target_ex           <= jump_target_id;
+                fallthrough_id           <= pc_if + 8;
+                fallthrough_ex           <= fallthrough_id;
+            end else if (ce) begin
+                redirected <= 1;
+            end
+        end
+
+        logic                        mispredicted;
+        logic                        predecoded_jump;
+        logic [Constants::WIDTH-1:0] predecoded_jump_target;
+        logic                        loop_branch;
+        always_comb begin
+            mispredicted  = jump_ex && !registered_branch_taken;
+            branch_taken  = !redirected && (
+                (registered_branch_taken && !(jump_ex && (registered_branch_target == jump_target_ex)))
+                || mispredicted
+            );
+            branch_target = mispredicted ? fallthrough_ex : registered_branch_target;
+            squash        = branch_taken;
+
+            loop_branch = loop_active && valid_if && (pc_if == (loop_last - 4));
+            jump        = predecoded_jump || loop_branch;
+            jump_target = predecoded_jump ? predecoded_jump_target : loop_start;
+
+            loop_branch_taken  = registered_branch_taken;
+            loop_branch_pc     = registered_branch_pc;
+            loop_branch_target = registered_branch_target;
+        end
+
+        jump_predecoder jump_predecoder_inst (
+            .valid       (valid_if && (ISSUE_WIDTH == 1)),
+            .pc          (pc_if                 ),
+            .instruction (instruction_if        ),
+            .jump        (predecoded_jump       ),
+            .target      (predecoded_jump_target)
+        );
+    end else begin : combinational_redirect
+        always_comb begin
+            branch_taken  = branch_taken_ex;
+            branch_target = branch_target_ex;
+            squash        = 0;
+            jump          = 0;
+            jump_target   = 0;
+
+            loop_branch_taken  = branch_taken_ex && !flush_if;
+            loop_branch_pc     = branch_pc_ex;
+            loop_branch_target = branch_target_ex;
+        end
+    end
+
+    if (ISSUE_WIDTH == 1) begin : scalar
+        pc_register #(
+            .THREAD_COUNT  (THREAD_COUNT),
+            .HOLD_REDIRECT (EXTERNAL    )
+        ) pc_register_inst (
+            .clk                (clk               ),
+            .nrst               (nrst              ),
+            .ce                 (ce                ),
+            .stall              (fetch_stall       ),
+            .branch_taken_ex    (branch_taken      ),
+            .branch_target_ex   (branch_target     ),
+            .branch_thread_ex   (branch_thread_ex  ),
+            .delay_slot_fetched (delay_slot_fetched),
+            .jump_if            (jump              ),
+            .jump_target_if     (jump_target       ),
+            .thread             (thread            ),
+            .pc                 (pc                )
+        );
+
+        // Only a single thread can still be fetching past the delay slot when
+        // the branch resolves.
+        always_comb begin
+            redirect  = (THREAD_COUNT == 1) && branch_taken && delay_slot_fetched;
+            buffer_pc = pc;
+        end
+    end else begin : dual
+        // Two words are fetched per cycle and the next fetch starts right
+        // behind the last one decode issued. A stall refetches the same pair.
+        always_comb begin
+            thread    = 0;
+            redirect  = 0;
+            pc        = branch_taken ? branch_target : (pc_if + (pair_id ? 8 : 4));
+            buffer_pc = stall ? (pc - 4) : pc;
+        end
+    end
+
+    logic [Constants::WIDTH-1:0] fetch_address;
+    always_comb begin
+        fetch_address = redirect ? branch_target : pc;
+    end
+
+    logic [Constants::WIDTH-1:0] rom_instruction;
     instruction_memory instruction_memory_inst (
         .pc (pc          ),
-        .branch_taken_ex (branch_taken_ex),
-        .branch_target_ex (branch_target_ex),
+        .branch_taken_ex (redirect),
+        .branch_target_ex (branch_target),
         .rom     (rom),
-        .out     (instruction )
+        .out     (rom_instruction)
     );
 
+    logic                        loop_hit ;
+    logic [Constants::WIDTH-1:0] loop_word;
+    if ((LOOP_BUFFER_SIZE != 0) && (THREAD_COUNT == 1) && (ISSUE_WIDTH == 1)) begin : loop
+        loop_buffer #(
+            .SIZE(LOOP_BUFFER_SIZE)
+        ) loop_buffer_inst (
+            .clk     (clk    ),
+            .nrst    (nrst   ),
+            .ce      (ce     ),
+            .ce_core (ce_core),
+            .
+            branch_taken_ex   (loop_branch_taken ),
+            .branch_pc_ex     (loop_branch_pc    ),
+            .branch_target_ex (loop_branch_target),
+            .
+            address    (fetch_address),
+            .rom_valid (memory_hit   ),
+            .rom_word  (memory_word  ),
+            .
+            hit     (loop_hit   ),
+            .word   (loop_word  ),
+            .active (loop_active),
+            .start  (loop_start ),
+            .last   (loop_last  )
+        );
+    end else begin : no_loop
+        always_comb begin
+            loop_hit    = 0;
+            loop_word   = 0;
+            loop_active = 0;
+            loop_start  = 0;
+            loop_last   = 0;
+        end
+    end
+
+    if (EXTERNAL && (PREFETCH_DEPTH != 0)) begin : prefetch
+        // The stream stops at the delay slot of a taken branch still being
+        // fetched, a branch that resolves behind it moves the address and
+        // restarts the stream at the target.
+        prefetcher #(
+            .DEPTH(PREFETCH_DEPTH)
+        ) prefetcher_inst (
+            .clk  (clk ),
+            .nrst (nrst),
+            .ce   (ce  ),
+            .
+            stall    (stall                             ),
+            .skip    (loop_hit                          ),
+            .cancel  (branch_taken && !delay_slot_fetched),
+            .address (fetch_address                     ),
+            .
+            hit        (memory_hit           ),
+            .word      (memory_word          ),
+            .issued    (prefetch_issued_if   ),
+            .used      (prefetch_used_if     ),
+            .discarded (prefetch_discarded_if),
+            .
+            request_valid    (instruction_request_valid_if  ),
+            .request_address (instruction_request_address_if),
+            .request_ready   (instruction_request_ready_if  ),
+            .response_valid  (instruction_response_valid_if ),
+            .response_data   (instruction_response_data_if  )
+        );
+    end else begin : no_prefetch
+        always_comb begin
+            prefetch_issued_if    = 0;
+            prefetch_used_if      = 0;
+            prefetch_discarded_if = 0;
+        end
+
+        if (EXTERNAL) begin : external_memory
+            instruction_port instruction_port_inst (
+                .clk  (clk ),
+                .nrst (nrst),
+                .ce   (ce  ),
+                .
+                stall    (stall        ),
+                .skip    (loop_hit     ),
+                .address (fetch_address),
+                .
+                hit   (memory_hit ),
+                .word (memory_word),
+                .
+                request_valid    (instruction_request_valid_if  ),
+                .request_address (instruction_request_address_if),
+                .request_ready   (instruction_request_ready_if  ),
+                .response_valid  (instruction_response_valid_if ),
+                .response_data   (instruction_response_data_if  )
+            );
+        end else begin : rom_memory
+            always_comb begin
+                instruction_request_valid_if   = 0;
+                instruction_request_address_if = 0;
+                memory_hit                     = 1;
+                memory_word                    = rom_instruction;
+            end
+        end
+    end
+
+    logic [Constants::WIDTH-1:0] instruction;
+    always_comb begin
+        if (EXTERNAL) begin
+            fetch_stall        = stall || (!loop_hit && !memory_hit);
+            delay_slot_fetched = buffer_valid || flush_if;
+            rom_read_if        = instruction_request_valid_if && instruction_request_ready_if;
+        end else begin
+            fetch_stall        = stall;
+            delay_slot_fetched = 1;
+            rom_read_if        = !loop_hit;
+        end
+        instruction = loop_hit ? loop_word : memory_word;
+    end
+
+    logic [Constants::WIDTH-1:0] lane1_instruction;
+    instruction_memory lane1_instruction_memory_inst (
+        .pc (pc + 4      ),
+        .branch_taken_ex (redirect),
+        .branch_target_ex (branch_target + 4),
+        .rom     (rom),
+        .out     (lane1_instruction)
+    );
+
+    logic [Constants::WIDTH-1:0] buffer_instruction      ;
+    logic [Constants::WIDTH-1:0] buffer_lane1_instruction;
     fetch_buffer fetch_buffer_inst (
         .clk             (clk                ),
         .nrst            (nrst               ),
-        .stall           (stall              ),
-        .pc_in           (pc                 ),
-        .branch_taken_ex    (branch_taken_ex       ),
-        .branch_target_ex   (branch_target_ex      ),
+        .ce              (ce                 ),
+        .stall           (fetch_stall        ),
+        .pc_in           (buffer_pc          ),
+        .thread_in       (thread             ),
+        .branch_taken_ex    (redirect       ),
+        .branch_target_ex   (branch_target         ),
         .instruction_in  (instruction        ),
+        .lane1_instruction_in (lane1_instruction),
+        .valid_out       (buffer_valid      ),
+        .thread_out      (thread_if     ),
         .pc_out          (pc_if         ),
-        .instruction_out (instruction_if)
+        .instruction_out (buffer_instruction),
+        .lane1_instruction_out (buffer_lane1_instruction)
     );
-endmodule
\ No newline at end of file
+
+    // The hazard controller flushes the word in IF behind an exception or
+    // eret, which redirect fetch without a delay slot, and behind the
+    // registered redirect, which asks for it through squash_if.
+    always_comb begin
+        squash_if            = squash;
+        valid_if             = buffer_valid && !flush_if;
+        instruction_if       = buffer_instruction;
+        lane1_instruction_if = buffer_lane1_instruction;
+    end
+endmodule
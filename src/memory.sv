@@ -1,5 +1,26 @@
+package Memory;
+    localparam logic [16-1:0]               MMIO_PAGE                  = 16'hffff;
+    localparam logic [3-1:0]                KSEG1_SEGMENT              = 3'b101;
+    localparam logic [Constants::WIDTH-1:0] PHYSICAL_ADDRESS_MASK      = 32'h1fff_ffff;
+    localparam logic [Constants::WIDTH-1:0] CONSOLE_TX_CONTROL_ADDRESS = 32'hffff_0008;
+    localparam logic [Constants::WIDTH-1:0] CONSOLE_TX_DATA_ADDRESS    = 32'hffff_000c;
+    localparam logic [Constants::WIDTH-1:0] DMA_SOURCE_ADDRESS         = 32'hffff_ffc0;
+    localparam logic [Constants::WIDTH-1:0] DMA_DESTINATION_ADDRESS    = 32'hffff_ffc4;
+    localparam logic [Constants::WIDTH-1:0] DMA_LENGTH_ADDRESS         = 32'hffff_ffc8;
+    localparam logic [Constants::WIDTH-1:0] DMA_FILL_ADDRESS           = 32'hffff_ffcc;
+    localparam logic [Constants::WIDTH-1:0] DMA_CONTROL_ADDRESS        = 32'hffff_ffd0;
+    localparam logic [Constants::WIDTH-1:0] TIMER_COUNT_LOW_ADDRESS    = 32'hffff_ffe0;
+    localparam logic [Constants::WIDTH-1:0] TIMER_COUNT_HIGH_ADDRESS   = 32'hffff_ffe4;
+    localparam logic [Constants::WIDTH-1:0] TIMER_COMPARE_LOW_ADDRESS  = 32'hffff_ffe8;
+    localparam logic [Constants::WIDTH-1:0] TIMER_COMPARE_HIGH_ADDRESS = 32'hffff_ffec;
+    localparam logic [Constants::WIDTH-1:0] TOHOST_ADDRESS             = 32'hffff_fff0;
+    localparam logic [Constants::WIDTH-1:0] THREAD_ID_ADDRESS          = 32'hffff_fff8;
+    localparam logic [Constants::WIDTH-1:0] CORE_ID_ADDRESS            = 32'hffff_fffc;
+endpackage
+
 module data_memory (
     input var logic clk,
+    input var logic ce ,
 
     input var logic         load                     ,
     input var logic [2-1:0] load_store_data_size_mode,
@@ -9,32 +30,60 @@ module data_memory (
     input var logic [Constants::WIDTH-1:0] address   ,
     input var logic [Constants::WIDTH-1:0] write_data,
 
+    input var logic                        snoop_store                    ,
+    input var logic [2-1:0]                snoop_load_store_data_size_mode,
+    input var logic [Constants::WIDTH-1:0] snoop_address                  ,
+    input var logic [Constants::WIDTH-1:0] snoop_write_data               ,
+
     output var logic [Constants::BYTE-1:0] ram [0:Constants::RAM_SIZE-1],
     output var logic [Constants::WIDTH-1:0] read_data
 );
     localparam int unsigned ADDRESS_WIDTH = $clog2(Constants::RAM_SIZE);
     logic [ADDRESS_WIDTH-1:0] address_trunc;
+    logic                     mmio;
+
+    logic                        write                    ;
+    logic [2-1:0]                write_data_size_mode     ;
+    logic [ADDRESS_WIDTH-1:0]    write_address_trunc      ;
+    logic [Constants::WIDTH-1:0] write_word               ;
+
+    // Stores of other cores sharing this RAM arrive on the snoop port, the
+    // arbiter never grants both in the same cycle.
+    always_comb begin
+        if (ce && store && !mmio) begin
+            write                = 1;
+            write_data_size_mode = load_store_data_size_mode;
+            write_address_trunc  = address_trunc;
+            write_word           = write_data;
+        end else begin
+            write                = snoop_store;
+            write_data_size_mode = snoop_load_store_data_size_mode;
+            write_address_trunc  = snoop_address[ADDRESS_WIDTH-1:0];
+            write_word           = snoop_write_data;
+        end
+    end
 
     always_ff @ (posedge clk) begin
-        if (store) begin
-            if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_WORD) begin
-                ram[address_trunc + 0] <= write_data[31:24];
-                ram[address_trunc + 1] <= write_data[23:16];
-                ram[address_trunc + 2] <= write_data[15:8];
-                ram[address_trunc + 3] <= write_data[7:0];
-            end else if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) begin
-                ram[address_trunc + 2] <= write_data[15:8];
-                ram[address_trunc + 3] <= write_data[7:0];
-            end else if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_BYTE) begin
-                ram[address_trunc + 3] <= write_data[7:0];
+        if (write) begin
+            if (write_data_size_mode == Decode::LoadStoreDataSizeMode_WORD) begin
+                ram[write_address_trunc + 0] <= write_word[31:24];
+                ram[write_address_trunc + 1] <= write_word[23:16];
+                ram[write_address_trunc + 2] <= write_word[15:8];
+                ram[write_address_trunc + 3] <= write_word[7:0];
+            end else if (write_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) begin
+                ram[write_address_trunc + 2] <= write_word[15:8];
+                ram[write_address_trunc + 3] <= write_word[7:0];
+            end else if (write_data_size_mode == Decode::LoadStoreDataSizeMode_BYTE) begin
+                ram[write_address_trunc + 3] <= write_word[7:0];
             end
         end
     end
 
     always_comb begin
         address_trunc = address[ADDRESS_WIDTH-1:0];
+        mmio = (address[Constants::WIDTH-1:16] == Memory::MMIO_PAGE);
         read_data = 0;
-        if (load) begin
+        if (load && !mmio) begin
             if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_BYTE) begin
                 read_data[7:0] = ram[address_trunc + 3];
             end else if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) begin
@@ -70,10 +119,607 @@ module data_memory (
     end
 endmodule
 
+// A PC indexed stride table for loads behind the data port. Once a load
+// repeats the stride it saw last time the word one stride ahead is requested
+// on the data port, in a cycle the core does not use it, and kept in the
+// prefetch slot of its entry. The next execution of that load is served from
+// there, or straight from the response if it is still on its way, without
+// waiting for the port. One prefetch is in flight at a time and the core
+// holds its own accesses while it is, so responses stay in order. Any store
+// touching a buffered or requested word drops it.
+module stride_prefetcher #(
+    parameter int unsigned ENTRIES = 4
+) (
+    input var logic clk ,
+    input var logic nrst,
+    input var logic ce  ,
+
+    input var logic                        load                     ,
+    input var logic [2-1:0]                load_store_data_size_mode,
+    input var logic [Constants::WIDTH-1:0] pc                       ,
+    input var logic [Constants::WIDTH-1:0] address                  ,
+
+    input var logic                        store        ,
+    input var logic [Constants::WIDTH-1:0] store_address,
+    input var logic                        snoop_store  ,
+    input var logic [Constants::WIDTH-1:0] snoop_address,
+
+    input  var logic port_request,
+    output var logic port_hold   ,
+
+    output var logic                        hit    ,
+    output var logic [Constants::WIDTH-1:0] word   ,
+    output var logic [Constants::WIDTH-1:0] loads  ,
+    output var logic [Constants::WIDTH-1:0] issued ,
+    output var logic [Constants::WIDTH-1:0] useful ,
+
+    output var logic                        request_valid  ,
+    output var logic [Constants::WIDTH-1:0] request_address,
+    input  var logic                        request_ready  ,
+    input  var logic                        response_valid ,
+    input  var logic [Constants::WIDTH-1:0] response_data
+);
+    logic [Constants::WIDTH-1:0] tag            [0:ENTRIES-1];
+    logic [Constants::WIDTH-1:0] last_address   [0:ENTRIES-1];
+    logic [Constants::WIDTH-1:0] stride         [0:ENTRIES-1];
+    logic                        buffer_valid   [0:ENTRIES-1];
+    logic [Constants::WIDTH-1:0] buffer_address [0:ENTRIES-1];
+    logic [Constants::WIDTH-1:0] buffer_word    [0:ENTRIES-1];
+
+    // pending from the decision until the response, live until a store to
+    // the word, presenting while the request waits for ready and requested
+    // once it was taken
+    logic                        pending        ;
+    logic                        pending_live   ;
+    logic [Constants::WIDTH-1:0] pending_index  ;
+    logic [Constants::WIDTH-1:0] pending_address;
+    logic                        presenting     ;
+    logic                        requested      ;
+
+    logic [Constants::WIDTH-1:0] index           ;
+    logic                        match           ;
+    logic [Constants::WIDTH-1:0] next_stride     ;
+    logic [Constants::WIDTH-1:0] prefetch_address;
+    logic                        prefetch        ;
+    logic                        response        ;
+    logic                        buffer_hit      ;
+    logic                        response_hit    ;
+    logic                        pending_stored  ;
+    always_comb begin
+        index            = (pc >> 2) % ENTRIES;
+        match            = tag[index] == pc;
+        next_stride      = address - last_address[index];
+        prefetch_address = address + next_stride;
+        prefetch         = (
+            load && match && (next_stride != 0) && (next_stride == stride[index])
+            && (prefetch_address[Constants::WIDTH-1:16] != Memory::MMIO_PAGE)
+            && !pending
+        );
+
+        response       = requested && response_valid;
+        pending_stored = (
+            (ce && store && ((store_address - pending_address + 3) < 7))
+            || (snoop_store && ((snoop_address - pending_address + 3) < 7))
+        );
+        buffer_hit     = load && match && buffer_valid[index] && (buffer_address[index] == address);
+        response_hit   = load && response && pending_live && (pending_address == address);
+        hit            = (buffer_hit || response_hit) && (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_WORD);
+        word           = buffer_hit ? buffer_word[index] : response_data;
+
+        request_valid   = pending && !requested && (presenting || !port_request);
+        request_address = pending_address;
+        port_hold       = presenting || requested;
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            loads           <= 0;
+            issued          <= 0;
+            useful          <= 0;
+            pending         <= 0;
+            pending_live    <= 0;
+            pending_index   <= 0;
+            pending_address <= 0;
+            presenting      <= 0;
+            requested       <= 0;
+            for (int unsigned i = 0; i < ENTRIES; i++) begin
+                tag[i]            <= 0;
+                last_address[i]   <= 0;
+                stride[i]         <= 0;
+                buffer_valid[i]   <= 0;
+                buffer_address[i] <= 0;
+                buffer_word[i]    <= 0;
+            end
+        end else begin
+            // Snooped stores reach the RAM even while this core is held by ce.
+            for (int unsigned i = 0; i < ENTRIES; i++) begin
+                if (
+                    (ce && store && ((store_address - buffer_address[i] + 3) < 7))
+                    || (snoop_store && ((snoop_address - buffer_address[i] + 3) < 7))
+                ) begin
+                    buffer_valid[i] <= 0;
+                end
+            end
+            if (ce && load) begin
+                tag[index]          <= pc;
+                last_address[index] <= address;
+                stride[index]       <= match ? next_stride : 0;
+                buffer_valid[index] <= 0;
+            end
+
+            // The port does not wait for ce, a request once shown stays until
+            // it is taken.
+            if (request_valid && request_ready) begin
+                presenting <= 0;
+                requested  <= 1;
+            end else if (request_valid) begin
+                presenting <= 1;
+            end
+            if (pending_stored) begin
+                pending_live <= 0;
+            end
+            if (response) begin
+                pending   <= 0;
+                requested <= 0;
+                if (pending_live && !pending_stored) begin
+                    buffer_valid[pending_index]   <= 1;
+                    buffer_address[pending_index] <= pending_address;
+                    buffer_word[pending_index]    <= response_data;
+                end
+            end
+            if (ce && prefetch) begin
+                pending         <= 1;
+                pending_live    <= 1;
+                pending_index   <= index;
+                pending_address <= prefetch_address;
+            end
+
+            if (ce) begin
+                loads  <= loads + {31'b0, load};
+                issued <= issued + {31'b0, prefetch};
+                useful <= useful + {31'b0, hit};
+            end
+        end
+    end
+endmodule
+
+// Loads and stores that leave the core go through a request/response port
+// with one request in flight, stores are acknowledged by a response as well.
+// The access is busy until its response arrives, a response that arrives
+// while ce is low is kept until the access leaves. hold keeps the request
+// back while another user of the port has one in flight. response_data is only
+// taken with response_valid and read_data is 0 without a request, so it can
+// be ORed with the memory mapped registers.
+module data_port (
+    input var logic clk ,
+    input var logic nrst,
+    input var logic ce  ,
+
+    input var logic         request                  ,
+    input var logic [2-1:0] load_store_data_size_mode,
+    input var logic         load_sign_extend         ,
+    input var logic         hold                     ,
+
+    output var logic                        busy     ,
+    output var logic [Constants::WIDTH-1:0] read_data,
+
+    output var logic                        request_valid ,
+    input  var logic                        request_ready ,
+    input  var logic                        response_valid,
+    input  var logic [Constants::WIDTH-1:0] response_data
+);
+    logic                        outstanding;
+    logic                        done       ;
+    logic [Constants::WIDTH-1:0] done_word  ;
+
+    logic                        response;
+    logic [Constants::WIDTH-1:0] word    ;
+    always_comb begin
+        response      = outstanding && response_valid;
+        word          = !request ? 0 : done ? done_word : response ? response_data : 0;
+        busy          = request && !done && !response;
+        request_valid = request && !outstanding && !done && !hold;
+
+        // The response holds the four bytes from the address on, sub-word
+        // accesses use the low end like data_memory does.
+        read_data = 0;
+        if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_BYTE) begin
+            read_data[7:0] = word[7:0];
+            if (load_sign_extend) begin
+                read_data[31:8] = {24{word[7]}};
+            end
+        end else if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) begin
+            read_data[15:0] = word[15:0];
+            if (load_sign_extend) begin
+                read_data[31:16] = {16{word[15]}};
+            end
+        end else if (load_store_data_size_mode == Decode::LoadStoreDataSizeMode_WORD) begin
+            read_data = word;
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            outstanding <= 0;
+            done        <= 0;
+            done_word   <= 0;
+        end else begin
+            if (request_valid && request_ready) begin
+                outstanding <= 1;
+            end else if (response) begin
+                outstanding <= 0;
+            end
+
+            if (ce && !busy) begin
+                done <= 0;
+            end else if (response) begin
+                done      <= 1;
+                done_word <= response_data;
+            end
+        end
+    end
+endmodule
+
+module tohost_register #(
+    parameter int unsigned THREAD_COUNT = 1
+) (
+    input var logic clk,
+    input var logic nrst,
+    input var logic ce,
+
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread    ,
+    input var logic                                  store     ,
+    input var logic [Constants::WIDTH-1:0]           address   ,
+    input var logic [Constants::WIDTH-1:0]           write_data,
+
+    output var logic [THREAD_COUNT-1:0]     tohost     ,
+    output var logic [Constants::WIDTH-1:0] tohost_data
+);
+    // Every thread exits on its own, the exit code of thread 0 is reported.
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            tohost      <= 0;
+            tohost_data <= 0;
+        end else if (ce && store && (address == Memory::TOHOST_ADDRESS) && !tohost[thread]) begin
+            tohost[thread] <= 1;
+            if (thread == 0) begin
+                tohost_data <= write_data;
+            end
+        end
+    end
+endmodule
+
+module link_register #(
+    parameter int unsigned THREAD_COUNT = 1
+) (
+    input var logic clk,
+    input var logic nrst,
+    input var logic ce,
+
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread           ,
+    input var logic                                  load_linked      ,
+    input var logic                                  store_conditional,
+    input var logic                                  store            ,
+    input var logic [Constants::WIDTH-1:0]           address          ,
+    input var logic                                  snoop_store      ,
+    input var logic [Constants::WIDTH-1:0]           snoop_address    ,
+
+    output var logic success
+);
+    logic [THREAD_COUNT-1:0]     linked        ;
+    logic [Constants::WIDTH-1:0] linked_address [0:THREAD_COUNT-1];
+
+    always_comb begin
+        success = linked[thread] && (address[Constants::WIDTH-1:2] == linked_address[thread][Constants::WIDTH-1:2]);
+    end
+
+    // Stores of sibling threads break a link just like snooped stores of other
+    // cores do. A snooped store to the word in the same cycle as the ll comes
+    // after the ll read it, the link is not set.
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            linked <= 0;
+            for (int unsigned i = 0; i < THREAD_COUNT; i++) begin
+                linked_address[i] <= 0;
+            end
+        end else begin
+            for (int unsigned i = 0; i < THREAD_COUNT; i++) begin
+                if (ce && load_linked && (thread == i)) begin
+                    linked[i]         <= !(snoop_store && (snoop_address[Constants::WIDTH-1:2] == address[Constants::WIDTH-1:2]));
+                    linked_address[i] <= address;
+                end else if (ce && store_conditional && (thread == i)) begin
+                    linked[i] <= 0;
+                end else if (ce && store && (thread != i) && (address[Constants::WIDTH-1:2] == linked_address[i][Constants::WIDTH-1:2])) begin
+                    linked[i] <= 0;
+                end else if (snoop_store && (snoop_address[Constants::WIDTH-1:2] == linked_address[i][Constants::WIDTH-1:2])) begin
+                    linked[i] <= 0;
+                end
+            end
+        end
+    end
+endmodule
+
+module core_id_register #(
+    parameter int unsigned CORE_ID = 0
+) (
+    input var logic                                  load   ,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread ,
+    input var logic [Constants::WIDTH-1:0]           address,
+
+    output var logic [Constants::WIDTH-1:0] read_data
+);
+    always_comb begin
+        read_data = 0;
+        if (load && (address == Memory::CORE_ID_ADDRESS)) begin
+            read_data = CORE_ID;
+        end else if (load && (address == Memory::THREAD_ID_ADDRESS)) begin
+            read_data = {{(Constants::WIDTH-Constants::THREAD_ID_WIDTH){1'b0}}, thread};
+        end
+    end
+endmodule
+
+module console (
+    input var logic clk,
+    input var logic nrst,
+    input var logic ce,
+
+    input var logic                        load      ,
+    input var logic                        store     ,
+    input var logic [Constants::WIDTH-1:0] address   ,
+    input var logic [Constants::WIDTH-1:0] write_data,
+    input var logic                        tx_ready  ,
+
+    output var logic [Constants::WIDTH-1:0] read_data,
+    output var logic                        tx       ,
+    output var logic [Constants::BYTE-1:0]  tx_data
+);
+    always_comb begin
+        read_data = 0;
+        if (load && (address == Memory::CONSOLE_TX_CONTROL_ADDRESS)) begin
+            read_data[0] = tx_ready;
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            tx      <= 0;
+            tx_data <= 0;
+        end else begin
+            tx <= ce && store && (address == Memory::CONSOLE_TX_DATA_ADDRESS);
+            if (ce && store && (address == Memory::CONSOLE_TX_DATA_ADDRESS)) begin
+                tx_data <= write_data[Constants::BYTE-1:0];
+            end
+        end
+    end
+endmodule
+
+// Free running 64 bit count of clock cycles since reset and a compare
+// register. Loading the low word of the count latches the high word, so a
+// low/high pair of loads reads one snapshot. The interrupt goes up once the
+// count reaches the compare value and stays up until compare is written.
+// The count is wall clock time, it does not look at ce and keeps going while
+// the core is stalled, held or halted, unlike the cycle_count performance
+// counter. Only the register accesses follow ce.
+module cycle_timer (
+    input var logic clk ,
+    input var logic nrst,
+    input var logic ce  ,
+
+    input var logic                        load      ,
+    input var logic                        store     ,
+    input var logic [Constants::WIDTH-1:0] address   ,
+    input var logic [Constants::WIDTH-1:0] write_data,
+
+    output var logic [Constants::WIDTH-1:0] read_data,
+    output var logic                        interrupt
+);
+    logic [64-1:0]               count     ;
+    logic [Constants::WIDTH-1:0] count_high;
+    logic [64-1:0]               compare   ;
+
+    always_comb begin
+        read_data = 0;
+        if (load) begin
+            if (address == Memory::TIMER_COUNT_LOW_ADDRESS) begin
+                read_data = count[31:0];
+            end else if (address == Memory::TIMER_COUNT_HIGH_ADDRESS) begin
+                read_data = count_high;
+            end else if (address == Memory::TIMER_COMPARE_LOW_ADDRESS) begin
+                read_data = compare[31:0];
+            end else if (address == Memory::TIMER_COMPARE_HIGH_ADDRESS) begin
+                read_data = compare[63:32];
+            end
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            count      <= 0;
+            count_high <= 0;
+            compare    <= '1;
+            interrupt  <= 0;
+        end else begin
+            count <= count + 1;
+            if (count == compare) begin
+                interrupt <= 1;
+            end
+
+            if (ce && load && (address == Memory::TIMER_COUNT_LOW_ADDRESS)) begin
+                count_high <= count[63:32];
+            end
+            if (ce && store && (address == Memory::TIMER_COMPARE_LOW_ADDRESS)) begin
+                compare[31:0] <= write_data;
+                interrupt     <= 0;
+            end
+            if (ce && store && (address == Memory::TIMER_COMPARE_HIGH_ADDRESS)) begin
+                compare[63:32] <= write_data;
+                interrupt      <= 0;
+            end
+        end
+    end
+endmodule
+
+// Copies or fills RAM a word per cycle while the core keeps running. Writing
+// bit 0 of the control register starts copying length bytes from source to
+// destination, with bit 1 set as well destination is filled with the fill
+// word instead. Reading it returns busy in bit 0 and done in bit 1. The
+// engine writes through the RAM write port the core stores through, when
+// both want it in the same cycle they take turns.
+module dma_engine (
+    input var logic clk ,
+    input var logic nrst,
+    input var logic ce  ,
+
+    input var logic                        load       ,
+    input var logic                        store      ,
+    input var logic [Constants::WIDTH-1:0] address    ,
+    input var logic [Constants::WIDTH-1:0] write_data ,
+    input var logic                        core_store ,
+    input var logic                        snoop_store,
+
+    input var logic [Constants::BYTE-1:0] ram [0:Constants::RAM_SIZE-1],
+
+    output var logic [Constants::WIDTH-1:0] read_data    ,
+    output var logic                        core_blocked ,
+    output var logic                        write        ,
+    output var logic [Constants::WIDTH-1:0] write_address,
+    output var logic [Constants::WIDTH-1:0] write_word
+);
+    localparam int unsigned ADDRESS_WIDTH = $clog2(Constants::RAM_SIZE);
+
+    logic [Constants::WIDTH-1:0] source     ;
+    logic [Constants::WIDTH-1:0] destination;
+    logic [Constants::WIDTH-1:0] length     ;
+    logic [Constants::WIDTH-1:0] fill       ;
+    logic                        fill_mode  ;
+    logic                        busy       ;
+    logic                        done       ;
+    logic                        core_turn  ;
+
+    logic [ADDRESS_WIDTH-1:0] source_trunc;
+    always_comb begin
+        source_trunc  = source[ADDRESS_WIDTH-1:0];
+        write         = busy && !snoop_store && (!core_store || !core_turn);
+        core_blocked  = core_store && write;
+        write_address = destination;
+        write_word    = fill_mode ? fill : {
+            ram[source_trunc + 0],
+            ram[source_trunc + 1],
+            ram[source_trunc + 2],
+            ram[source_trunc + 3]
+        };
+
+        read_data = 0;
+        if (load) begin
+            if (address == Memory::DMA_SOURCE_ADDRESS) begin
+                read_data = source;
+            end else if (address == Memory::DMA_DESTINATION_ADDRESS) begin
+                read_data = destination;
+            end else if (address == Memory::DMA_LENGTH_ADDRESS) begin
+                read_data = length;
+            end else if (address == Memory::DMA_FILL_ADDRESS) begin
+                read_data = fill;
+            end else if (address == Memory::DMA_CONTROL_ADDRESS) begin
+                read_data[1:0] = { done, busy };
+            end
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            source      <= 0;
+            destination <= 0;
+            length      <= 0;
+            fill        <= 0;
+            fill_mode   <= 0;
+            busy        <= 0;
+            done        <= 0;
+            core_turn   <= 1;
+        end else begin
+            if (busy && core_store && !snoop_store) begin
+                core_turn <= !core_turn;
+            end
+
+            if (write) begin
+                source      <= source + 4;
+                destination <= destination + 4;
+                length      <= (length > 4) ? (length - 4) : 0;
+                if (length <= 4) begin
+                    busy <= 0;
+                    done <= 1;
+                end
+            end
+
+            if (ce && store && (address == Memory::DMA_SOURCE_ADDRESS)) begin
+                source <= write_data;
+            end
+            if (ce && store && (address == Memory::DMA_DESTINATION_ADDRESS)) begin
+                destination <= write_data;
+            end
+            if (ce && store && (address == Memory::DMA_LENGTH_ADDRESS)) begin
+                length <= write_data;
+            end
+            if (ce && store && (address == Memory::DMA_FILL_ADDRESS)) begin
+                fill <= write_data;
+            end
+            if (ce && store && (address == Memory::DMA_CONTROL_ADDRESS) && write_data[0]) begin
+                fill_mode <= write_data[1];
+                busy      <= (length != 0);
+                done      <= (length == 0);
+            end
+        end
+    end
+endmodule
+
+// Per-stage hold and flush of the pipeline. stall_* holds a stage register
+// with its word, flush_* turns the word leaving a stage into a bubble.
+// - ME holds while its access waits on the data port. EX holds while a
+//   custom instruction waits on the accelerator or a multiply works through
+//   its digits, and ME holds with it since EX takes operands read in decode
+//   forwarded from ME and WB.
+// - ID holds whenever EX does, IF only if it has a word ID cannot take, so
+//   fetch may still fill an empty decode slot while the core waits.
+// - bubble_if sends bubbles from IF on while the stall input is set.
+// - flush_if drops the word in IF behind an exception or eret taken in EX
+//   and behind the registered redirect of fetch, which asks for it with
+//   squash. flush_id drops the instruction in EX that takes an exception.
+module hazard_controller (
+    input var logic ce              ,
+    input var logic stall           ,
+    input var logic data_busy       ,
+    input var logic accelerator_busy,
+    input var logic mac_busy        ,
+    input var logic valid_if        ,
+    input var logic squash          ,
+    input var logic exception       ,
+    input var logic redirect        ,
+
+    output var logic stall_if ,
+    output var logic stall_id ,
+    output var logic stall_ex ,
+    output var logic stall_me ,
+    output var logic bubble_if,
+    output var logic flush_if ,
+    output var logic flush_id
+);
+    always_comb begin
+        stall_me  = data_busy || accelerator_busy || mac_busy;
+        stall_ex  = stall_me;
+        stall_id  = stall_ex;
+        stall_if  = stall_id && valid_if;
+        bubble_if = stall;
+        flush_if  = squash || (redirect && ce && !stall_ex);
+        flush_id  = exception;
+    end
+endmodule
+
 module memory_buffer (
     input var logic clk,
     input var logic nrst,
+    input var logic ce,
 
+    input var logic                                 valid_in     ,
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_in   ,
     input var logic [Constants::WIDTH-1:0]          pc_in        ,
     input var logic                                 load_in      ,
     input var logic [Constants::WIDTH-1:0]          read_data_in ,
@@ -82,6 +728,8 @@ module memory_buffer (
     input var logic                                 rd_in        ,
     input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_in,
 
+    output var logic                                 valid_out     ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_out   ,
     output var logic [Constants::WIDTH-1:0]          pc_out        ,
     output var logic                                 load_out      ,
     output var logic [Constants::WIDTH-1:0]          read_data_out ,
@@ -92,6 +740,8 @@ module memory_buffer (
 );
     always_ff @ (posedge clk, negedge nrst) begin
         if (!nrst) begin
+            valid_out      <= 0;
+            thread_out     <= 0;
             pc_out         <= 0;
             load_out       <= 0;
             read_data_out  <= 0;
@@ -99,7 +749,9 @@ module memory_buffer (
             alu_result_out <= 0;
             rd_out         <= 0;
             rd_address_out <= 0;
-        end else begin
+        end else if (ce) begin
+            valid_out      <= valid_in;
+            thread_out     <= thread_in;
             pc_out         <= pc_in;
             load_out       <= load_in;
             read_data_out  <= read_data_in;
@@ -111,16 +763,53 @@ module memory_buffer (
     end
 endmodule
 
-module memory (
+module memory #(
+    parameter int unsigned CORE_ID               = 0,
+    parameter int unsigned THREAD_COUNT          = 1,
+    parameter int unsigned ISSUE_WIDTH           = 1,
+    parameter bit          REGISTERED_REDIRECT   = 0,
+    parameter int unsigned LOOP_BUFFER_SIZE      = 0,
+    parameter int unsigned PREFETCH_DEPTH        = 0,
+    parameter int unsigned DATA_PREFETCH_ENTRIES = 0,
+    parameter bit          EXTERNAL_MEMORY       = 0,
+    parameter bit          DMA_ENGINE            = 0,
+    parameter bit          CP0                   = 0,
+    parameter bit          TIMER                 = 0,
+    parameter bit          MULTIPLY_ACCUMULATE   = 0,
+    parameter bit          ACCELERATOR           = 0
+) (
     input  var logic                        clk                ,
     input  var logic                        nrst                ,
+    input  var logic                        ce                 ,
     input  var logic [Constants::BYTE-1:0]  rom     [0:Constants::ROM_SIZE-1],
     input  var logic                        stall              ,
+    input  var logic                        console_tx_ready   ,
+    input  var logic [6-1:0]                interrupts         ,
+
+    input var logic                        snoop_store                    ,
+    input var logic [2-1:0]                snoop_load_store_data_size_mode,
+    input var logic [Constants::WIDTH-1:0] snoop_address                  ,
+    input var logic [Constants::WIDTH-1:0] snoop_write_data               ,
+
+    input var logic                        instruction_request_ready_if ,
+    input var logic                        instruction_response_valid_if,
+    input var logic [Constants::WIDTH-1:0] instruction_response_data_if ,
+    input var logic                        data_request_ready_ex ,
+    input var logic                        data_response_valid_ex,
+    input var logic [Constants::WIDTH-1:0] data_response_data_ex ,
 
+    input var logic [Constants::THREAD_ID_WIDTH-1:0] thread_wb   ,
     input var logic                                 rd_wb        ,
     input var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb,
     input var logic [Constants::WIDTH-1:0]          rd_data_wb   ,
 
+    input var logic                                 lane1_rd_wb        ,
+    input var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address_wb,
+    input var logic [Constants::WIDTH-1:0]          lane1_rd_data_wb   ,
+
+    output var logic                                 valid_ex     ,
+    output var logic                                 valid_me     ,
+    output var logic [Constants::THREAD_ID_WIDTH-1:0] thread_me   ,
     output var logic [Constants::WIDTH-1:0]          pc_me        ,
     output var logic [Constants::BYTE-1:0] ram [0:Constants::RAM_SIZE-1],
     output var logic                                 load_me      ,
@@ -129,79 +818,477 @@ module memory (
     output var logic [Constants::WIDTH-1:0]          alu_result_me,
     output var logic                                 rd_me        ,
     output var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_me,
+    output var logic [THREAD_COUNT-1:0]              idle_ex      ,
+    output var logic                                 rom_read_if  ,
+    output var logic [Constants::WIDTH-1:0]          prefetch_issued_if   ,
+    output var logic [Constants::WIDTH-1:0]          prefetch_used_if     ,
+    output var logic [Constants::WIDTH-1:0]          prefetch_discarded_if,
+    output var logic [Constants::WIDTH-1:0]          data_loads_ex          ,
+    output var logic [Constants::WIDTH-1:0]          data_prefetch_issued_ex,
+    output var logic [Constants::WIDTH-1:0]          data_prefetch_useful_ex,
+    output var logic [THREAD_COUNT-1:0]              tohost_me     ,
+    output var logic [Constants::WIDTH-1:0]          tohost_data_me,
+    output var logic                                 console_tx_me     ,
+    output var logic [Constants::BYTE-1:0]           console_tx_data_me,
+    output var logic                                 instruction_request_valid_if  ,
+    output var logic [Constants::WIDTH-1:0]          instruction_request_address_if,
+    output var logic                                 data_busy_ex   ,
+    output var logic                                 data_request_ex,
+    output var logic                                 data_store_ex,
+    output var logic [2-1:0]                         data_load_store_data_size_mode_ex,
+    output var logic [Constants::WIDTH-1:0]          data_address_ex,
+    output var logic [Constants::WIDTH-1:0]          data_write_data_ex,
+
+    output var logic                                 lane1_valid_ex     ,
+    output var logic [Constants::WIDTH-1:0]          lane1_pc_me        ,
+    output var logic                                 lane1_alu_mode_me  ,
+    output var logic [Constants::WIDTH-1:0]          lane1_alu_result_me,
+    output var logic                                 lane1_rd_me        ,
+    output var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address_me,
     output var logic [Constants::WIDTH-1:0] reg_file [0:Constants::REG_COUNT - 1-1]
 );
-    var logic [Constants::WIDTH-1:0] pc_ex           ;
+    var logic valid_if           ;
+    var logic squash_if          ;
+    var logic accelerator_busy_ex;
+    var logic mac_busy_ex        ;
+    var logic cop0_exception_ex  ;
+    var logic cop0_redirect_ex   ;
+    var logic stall_if           ;
+    var logic stall_id           ;
+    var logic stall_ex           ;
+    var logic stall_me           ;
+    var logic bubble_if          ;
+    var logic flush_if           ;
+    var logic flush_id           ;
+    hazard_controller hazard_controller_inst (
+        .ce               (ce                 ),
+        .stall            (stall              ),
+        .data_busy        (data_busy_ex       ),
+        .accelerator_busy (accelerator_busy_ex),
+        .mac_busy         (mac_busy_ex        ),
+        .valid_if         (valid_if           ),
+        .squash           (squash_if          ),
+        .exception        (cop0_exception_ex  ),
+        .redirect         (cop0_redirect_ex   ),
+        .
+        stall_if   (stall_if ),
+        .stall_id  (stall_id ),
+        .stall_ex  (stall_ex ),
+        .stall_me  (stall_me ),
+        .bubble_if (bubble_if),
+        .flush_if  (flush_if ),
+        .flush_id  (flush_id )
+    );
 
-    var logic                                 rd_ex        ;
-    var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_ex;
+    var logic ce_if;
+    var logic ce_id;
+    var logic ce_ex;
+    var logic ce_me;
+    always_comb begin
+        ce_if = ce && !stall_if;
+        ce_id = ce && !stall_id;
+        ce_ex = ce && !stall_ex;
+        ce_me = ce && !stall_me;
+    end
+
+    var logic [Constants::THREAD_ID_WIDTH-1:0] thread_ex;
+    var logic [Constants::WIDTH-1:0] pc_ex           ;
 
-    var logic                        alu_mode_ex  ;
+    var Decode::Control              control_ex   ;
     var logic [Constants::WIDTH-1:0] alu_result_ex;
+    var logic [Constants::WIDTH-1:0] rt_data_ex   ;
 
-    var logic [Constants::WIDTH-1:0] rt_data_ex;
+    var logic [Constants::WIDTH-1:0] lane1_pc_ex        ;
+    var Decode::Control              lane1_control_ex   ;
+    var logic [Constants::WIDTH-1:0] lane1_alu_result_ex;
 
-    var logic         load_ex                     ;
-    var logic [2-1:0] load_store_data_size_mode_ex;
-    var logic         load_sign_extend_ex         ;
-    var logic         store_ex                    ;
+    // The timer interrupt comes in on the highest line.
+    logic [Constants::WIDTH-1:0] timer_read_data;
+    logic                        timer_interrupt;
 
-    execute execute_inst (
+    execute #(
+        .THREAD_COUNT        (THREAD_COUNT       ),
+        .ISSUE_WIDTH         (ISSUE_WIDTH        ),
+        .REGISTERED_REDIRECT (REGISTERED_REDIRECT),
+        .LOOP_BUFFER_SIZE    (LOOP_BUFFER_SIZE   ),
+        .PREFETCH_DEPTH      (PREFETCH_DEPTH     ),
+        .EXTERNAL_MEMORY     (EXTERNAL_MEMORY    ),
+        .CP0                 (CP0                ),
+        .MULTIPLY_ACCUMULATE (MULTIPLY_ACCUMULATE),
+        .ACCELERATOR         (ACCELERATOR        )
+    ) execute_inst (
         .clk(clk),
         .nrst(nrst),
+        .ce(ce_ex),
+        .ce_id(ce_id),
+        .ce_if(ce_if),
         .rom(rom),
-        .stall(stall),
+        .stall(bubble_if),
+        .flush_if(flush_if),
+        .flush_id(flush_id),
+        .instruction_request_ready_if(instruction_request_ready_if),
+        .instruction_response_valid_if(instruction_response_valid_if),
+        .instruction_response_data_if(instruction_response_data_if),
+        .interrupts(interrupts | {timer_interrupt, 5'b0_0000}),
 
+        .thread_wb(thread_wb),
         .rd_wb(rd_wb),
         .rd_address_wb(rd_address_wb),
         .rd_data_wb(rd_data_wb),
 
-        .pc_ex(pc_ex),
+        .lane1_rd_wb(lane1_rd_wb),
+        .lane1_rd_address_wb(lane1_rd_address_wb),
+        .lane1_rd_data_wb(lane1_rd_data_wb),
 
-        .rd_ex(rd_ex),
-        .rd_address_ex(rd_address_ex),
+        .valid_if(valid_if),
+        .squash_if(squash_if),
+        .valid_ex(valid_ex),
+        .thread_ex(thread_ex),
+        .pc_ex(pc_ex),
 
-        .alu_mode_ex(alu_mode_ex),
+        .control_ex(control_ex),
         .alu_result_ex(alu_result_ex),
-
         .rt_data_ex(rt_data_ex),
 
-        .load_ex(load_ex),
-        .load_store_data_size_mode_ex(load_store_data_size_mode_ex),
-        .load_sign_extend_ex(load_sign_extend_ex),
-        .store_ex(store_ex),
+        .idle_ex(idle_ex),
+        .accelerator_busy_ex(accelerator_busy_ex),
+        .mac_busy_ex(mac_busy_ex),
+        .cop0_exception_ex(cop0_exception_ex),
+        .cop0_redirect_ex(cop0_redirect_ex),
+        .rom_read_if(rom_read_if),
+        .prefetch_issued_if(prefetch_issued_if),
+        .prefetch_used_if(prefetch_used_if),
+        .prefetch_discarded_if(prefetch_discarded_if),
+        .instruction_request_valid_if(instruction_request_valid_if),
+        .instruction_request_address_if(instruction_request_address_if),
+
+        .lane1_valid_ex(lane1_valid_ex),
+        .lane1_pc_ex(lane1_pc_ex),
+        .lane1_control_ex(lane1_control_ex),
+        .lane1_alu_result_ex(lane1_alu_result_ex),
         .reg_file(reg_file) 
     );
 
-    logic [Constants::WIDTH-1:0] read_data;
+    // The DMA engine writes RAM through the snoop port, it holds off while a
+    // snooped store comes in.
+    logic                        ram_snoop_store                    ;
+    logic [2-1:0]                ram_snoop_load_store_data_size_mode;
+    logic [Constants::WIDTH-1:0] ram_snoop_address                  ;
+    logic [Constants::WIDTH-1:0] ram_snoop_write_data               ;
+
+    // kuseg, kseg0 and kseg1 all reach the same physical memory like on the
+    // R2000, kseg1 and MMIO bypass the data prefetcher. Everything that
+    // compares addresses of RAM accesses sees the physical one, so a store
+    // through one alias hits what was read through another.
+    logic                        uncached_ex        ;
+    logic [Constants::WIDTH-1:0] physical_address_ex;
+
+    logic store_conditional_success;
+    link_register #(
+        .THREAD_COUNT(THREAD_COUNT)
+    ) link_register_inst (
+        .clk  (clk    ),
+        .nrst (nrst   ),
+        .ce   (ce_me),
+        .
+        thread             (thread_ex                               ),
+        .load_linked       (valid_ex && control_ex.LOAD_LINKED      ),
+        .store_conditional (valid_ex && control_ex.STORE_CONDITIONAL),
+        .store             (store_committed                         ),
+        .address           (physical_address_ex                     ),
+        .snoop_store       (ram_snoop_store                         ),
+        .snoop_address     (ram_snoop_address                       ),
+        .
+        success (store_conditional_success)
+    );
+
+    // Every decoder of an access in ME takes load_ex and store_committed,
+    // which only hold for a valid instruction, so a bubble never reads a
+    // memory mapped register or writes anything.
+    logic mmio_ex;
+    logic load_ex;
+    logic store_committed;
+    logic data_access_ex;
+    logic data_request_valid_ex;
+
+    logic                        data_prefetch_hit            ;
+    logic [Constants::WIDTH-1:0] data_prefetch_word           ;
+    logic                        data_prefetch_hold           ;
+    logic                        data_prefetch_request_valid  ;
+    logic [Constants::WIDTH-1:0] data_prefetch_request_address;
+    always_comb begin
+        mmio_ex       = (alu_result_ex[Constants::WIDTH-1:16] == Memory::MMIO_PAGE);
+        uncached_ex   = mmio_ex || (alu_result_ex[Constants::WIDTH-1:29] == Memory::KSEG1_SEGMENT);
+        physical_address_ex = mmio_ex ? alu_result_ex : (alu_result_ex & Memory::PHYSICAL_ADDRESS_MASK);
+        load_ex         = valid_ex && control_ex.LOAD;
+        store_committed = valid_ex && control_ex.STORE && (!control_ex.STORE_CONDITIONAL || store_conditional_success);
+
+        // A load served by the data prefetcher does not use the port, a
+        // prefetch goes out as a word load in a cycle the core leaves it free.
+        data_access_ex                    = valid_ex && (control_ex.LOAD || control_ex.STORE) && !mmio_ex && !data_prefetch_hit;
+        data_request_ex                   = EXTERNAL_MEMORY ? (data_request_valid_ex || data_prefetch_request_valid) : data_access_ex;
+        data_store_ex                     = store_committed && !mmio_ex && !data_prefetch_request_valid;
+        data_load_store_data_size_mode_ex = data_prefetch_request_valid ? Decode::LoadStoreDataSizeMode_WORD : control_ex.LOAD_STORE_DATA_SIZE_MODE;
+        data_address_ex                   = data_prefetch_request_valid ? data_prefetch_request_address : physical_address_ex;
+        data_write_data_ex                = rt_data_ex;
+    end
+
+    logic [Constants::WIDTH-1:0] dma_read_data    ;
+    logic                        dma_blocked      ;
+    logic                        dma_write        ;
+    logic [Constants::WIDTH-1:0] dma_write_address;
+    logic [Constants::WIDTH-1:0] dma_write_word   ;
+    if (DMA_ENGINE && !EXTERNAL_MEMORY) begin : dma
+        dma_engine dma_engine_inst (
+            .clk  (clk    ),
+            .nrst (nrst   ),
+            .ce   (ce_me),
+            .
+            load         (load_ex                          ),
+            .store       (store_committed                  ),
+            .address     (alu_result_ex                    ),
+            .write_data  (rt_data_ex                       ),
+            .core_store  (ce && store_committed && !mmio_ex),
+            .snoop_store (snoop_store                      ),
+            .
+            ram(ram),
+            .
+            read_data      (dma_read_data    ),
+            .core_blocked  (dma_blocked      ),
+            .write         (dma_write        ),
+            .write_address (dma_write_address),
+            .write_word    (dma_write_word   )
+        );
+    end else begin : no_dma
+        always_comb begin
+            dma_read_data     = 0;
+            dma_blocked       = 0;
+            dma_write         = 0;
+            dma_write_address = 0;
+            dma_write_word    = 0;
+        end
+    end
+
+    always_comb begin
+        if (dma_write) begin
+            ram_snoop_store                     = 1;
+            ram_snoop_load_store_data_size_mode = Decode::LoadStoreDataSizeMode_WORD;
+            ram_snoop_address                   = dma_write_address & Memory::PHYSICAL_ADDRESS_MASK;
+            ram_snoop_write_data                = dma_write_word;
+        end else begin
+            ram_snoop_store                     = snoop_store;
+            ram_snoop_load_store_data_size_mode = snoop_load_store_data_size_mode;
+            ram_snoop_address                   = snoop_address & Memory::PHYSICAL_ADDRESS_MASK;
+            ram_snoop_write_data                = snoop_write_data;
+        end
+    end
+
+    logic [Constants::WIDTH-1:0] ram_read_data;
     data_memory data_memory_inst (
-        .clk (clk),
+        .clk (clk    ),
+        .ce  (ce_me),
         .
-        load                      (load_ex),
-        .load_store_data_size_mode (load_store_data_size_mode_ex),
-        .load_sign_extend          (load_sign_extend_ex),
-        .store                     (store_ex),
+        load                       (load_ex                             ),
+        .load_store_data_size_mode (control_ex.LOAD_STORE_DATA_SIZE_MODE),
+        .load_sign_extend          (control_ex.LOAD_SIGN_EXTEND         ),
+        .store                     (store_committed                     ),
         .
         address    (alu_result_ex),
         .write_data (rt_data_ex),
         .
+        snoop_store                      (ram_snoop_store                    ),
+        .snoop_load_store_data_size_mode (ram_snoop_load_store_data_size_mode),
+        .snoop_address                   (ram_snoop_address                  ),
+        .snoop_write_data                (ram_snoop_write_data               ),
+        .
         ram(ram),
-        .read_data (read_data)
+        .read_data (ram_read_data)
+    );
+
+    // The prefetcher reads ahead over the data port, the internal RAM answers
+    // every load in the same cycle and leaves it nothing to hide.
+    if ((DATA_PREFETCH_ENTRIES != 0) && EXTERNAL_MEMORY) begin : data_prefetch
+        stride_prefetcher #(
+            .ENTRIES(DATA_PREFETCH_ENTRIES)
+        ) stride_prefetcher_inst (
+            .clk  (clk    ),
+            .nrst (nrst   ),
+            .ce   (ce_me),
+            .
+            load                       (load_ex && !uncached_ex                    ),
+            .load_store_data_size_mode (control_ex.LOAD_STORE_DATA_SIZE_MODE       ),
+            .pc                        (pc_ex                                      ),
+            .address                   (physical_address_ex                        ),
+            .
+            store          (store_committed && !mmio_ex),
+            .store_address (physical_address_ex        ),
+            .snoop_store   (ram_snoop_store            ),
+            .snoop_address (ram_snoop_address          ),
+            .
+            port_request (data_access_ex    ),
+            .port_hold   (data_prefetch_hold),
+            .
+            hit     (data_prefetch_hit      ),
+            .word   (data_prefetch_word     ),
+            .loads  (data_loads_ex          ),
+            .issued (data_prefetch_issued_ex),
+            .useful (data_prefetch_useful_ex),
+            .
+            request_valid    (data_prefetch_request_valid  ),
+            .request_address (data_prefetch_request_address),
+            .request_ready   (data_request_ready_ex        ),
+            .response_valid  (data_response_valid_ex       ),
+            .response_data   (data_response_data_ex        )
+        );
+    end else begin : no_data_prefetch
+        always_comb begin
+            data_prefetch_hit             = 0;
+            data_prefetch_word            = 0;
+            data_prefetch_hold            = 0;
+            data_prefetch_request_valid   = 0;
+            data_prefetch_request_address = 0;
+            data_loads_ex                 = 0;
+            data_prefetch_issued_ex       = 0;
+            data_prefetch_useful_ex       = 0;
+        end
+    end
+
+    logic                        data_port_busy    ;
+    logic [Constants::WIDTH-1:0] external_read_data;
+    if (EXTERNAL_MEMORY) begin : external_data
+        // The access only leaves once a custom instruction or multiply in EX
+        // is done too.
+        data_port data_port_inst (
+            .clk  (clk                                        ),
+            .nrst (nrst                                       ),
+            .ce   (ce && !accelerator_busy_ex && !mac_busy_ex),
+            .
+            request                    (data_access_ex                      ),
+            .load_store_data_size_mode (control_ex.LOAD_STORE_DATA_SIZE_MODE),
+            .load_sign_extend          (control_ex.LOAD_SIGN_EXTEND         ),
+            .hold                      (data_prefetch_hold                  ),
+            .
+            busy       (data_port_busy    ),
+            .read_data (external_read_data),
+            .
+            request_valid   (data_request_valid_ex ),
+            .request_ready  (data_request_ready_ex ),
+            .response_valid (data_response_valid_ex),
+            .response_data  (data_response_data_ex )
+        );
+    end else begin : internal_data
+        always_comb begin
+            data_port_busy        = 0;
+            external_read_data    = 0;
+            data_request_valid_ex = 0;
+        end
+    end
+
+    // A store that lost the RAM write port to the DMA engine waits like an
+    // access on the data port does.
+    always_comb begin
+        data_busy_ex = data_port_busy || dma_blocked;
+    end
+
+    logic [Constants::WIDTH-1:0] console_read_data;
+    console console_inst (
+        .clk  (clk    ),
+        .nrst (nrst   ),
+        .ce   (ce_me),
+        .
+        load        (load_ex         ),
+        .store      (store_committed ),
+        .address    (alu_result_ex   ),
+        .write_data (rt_data_ex      ),
+        .tx_ready   (console_tx_ready),
+        .
+        read_data (console_read_data ),
+        .tx       (console_tx_me     ),
+        .tx_data  (console_tx_data_me)
+    );
+
+    if (TIMER) begin : timer
+        cycle_timer cycle_timer_inst (
+            .clk  (clk    ),
+            .nrst (nrst   ),
+            .ce   (ce_me),
+            .
+            load        (load_ex        ),
+            .store      (store_committed),
+            .address    (alu_result_ex  ),
+            .write_data (rt_data_ex     ),
+            .
+            read_data  (timer_read_data),
+            .interrupt (timer_interrupt)
+        );
+    end else begin : no_timer
+        always_comb begin
+            timer_read_data = 0;
+            timer_interrupt = 0;
+        end
+    end
+
+    logic [Constants::WIDTH-1:0] core_id_read_data;
+    core_id_register #(
+        .CORE_ID(CORE_ID)
+    ) core_id_register_inst (
+        .load    (load_ex        ),
+        .thread  (thread_ex      ),
+        .address (alu_result_ex  ),
+        .
+        read_data (core_id_read_data)
+    );
+
+    logic [Constants::WIDTH-1:0] read_data;
+    always_comb begin
+        if (control_ex.STORE_CONDITIONAL) begin
+            read_data = {{(Constants::WIDTH-1){1'b0}}, store_conditional_success};
+        end else begin
+            read_data = (
+                (
+                    data_prefetch_hit ? data_prefetch_word :
+                    EXTERNAL_MEMORY ? external_read_data :
+                    ram_read_data
+                )
+                | console_read_data | core_id_read_data | dma_read_data | timer_read_data
+            );
+        end
+    end
+
+    tohost_register #(
+        .THREAD_COUNT(THREAD_COUNT)
+    ) tohost_register_inst (
+        .clk  (clk    ),
+        .nrst (nrst   ),
+        .ce   (ce_me),
+        .
+        thread      (thread_ex      ),
+        .store      (store_committed),
+        .address    (alu_result_ex),
+        .write_data (rt_data_ex   ),
+        .
+        tohost       (tohost_me     ),
+        .tohost_data (tohost_data_me)
     );
 
     memory_buffer memory_buffer_inst (
         .clk (clk),
         .nrst (nrst),
+        .ce (ce_me),
         .
-        pc_in          (pc_ex),
-        .load_in       (load_ex    ),
-        .read_data_in  (read_data),
-        .alu_mode_in   (alu_mode_ex),
-        .alu_result_in (alu_result_ex),
-        .rd_in         (rd_ex),
-        .rd_address_in (rd_address_ex),
+        valid_in       (valid_ex             ),
+        .thread_in     (thread_ex            ),
+        .pc_in         (pc_ex                ),
+        .load_in       (control_ex.LOAD      ),
+        .read_data_in  (read_data            ),
+        .alu_mode_in   (control_ex.ALU_MODE  ),
+        .alu_result_in (alu_result_ex        ),
+        .rd_in         (control_ex.RD        ),
+        .rd_address_in (control_ex.RD_ADDRESS),
         .
-        pc_out         (pc_me        ),
+        valid_out      (valid_me     ),
+        .thread_out     (thread_me    ),
+        .pc_out         (pc_me        ),
         .load_out       (load_me      ),
         .read_data_out  (read_data_me ),
         .alu_mode_out   (alu_mode_me  ),
@@ -209,4 +1296,35 @@ module memory (
         .rd_out         (rd_me        ),
         .rd_address_out (rd_address_me)
     );
+
+    logic                                  lane1_valid_me    ;
+    logic [Constants::THREAD_ID_WIDTH-1:0] lane1_thread_me   ;
+    logic                                  lane1_load_me     ;
+    logic [Constants::WIDTH-1:0]           lane1_read_data_me;
+
+    memory_buffer lane1_memory_buffer_inst (
+        .clk (clk),
+        .nrst (nrst),
+        .ce (ce_me),
+        .
+        valid_in       (lane1_valid_ex             ),
+        .thread_in     (thread_ex                  ),
+        .pc_in         (lane1_pc_ex                ),
+        .load_in       (1'b0                       ),
+        .read_data_in  (32'h0000_0000              ),
+        .alu_mode_in   (lane1_control_ex.ALU_MODE  ),
+        .alu_result_in (lane1_alu_result_ex        ),
+        .rd_in         (lane1_control_ex.RD        ),
+        .rd_address_in (lane1_control_ex.RD_ADDRESS),
+        .
+        valid_out      (lane1_valid_me     ),
+        .thread_out     (lane1_thread_me    ),
+        .pc_out         (lane1_pc_me        ),
+        .load_out       (lane1_load_me      ),
+        .read_data_out  (lane1_read_data_me ),
+        .alu_mode_out   (lane1_alu_mode_me  ),
+        .alu_result_out (lane1_alu_result_me),
+        .rd_out         (lane1_rd_me        ),
+        .rd_address_out (lane1_rd_address_me)
+    );
 endmodule
\ No newline at end of file
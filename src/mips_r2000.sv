@@ -16,34 +16,329 @@ module writeback (
     end
 endmodule
 
-module mips_r2000 (
+module performance_counters (
+    input var logic clk        ,
+    input var logic nrst       ,
+    input var logic ce         ,
+    input var logic valid      ,
+    input var logic lane1_valid,
+    input var logic bubble     ,
+    input var logic rom_read   ,
+
+    output var logic [Constants::WIDTH-1:0] cycle_count,
+    output var logic [Constants::WIDTH-1:0] instret    ,
+    output var logic [Constants::WIDTH-1:0] bubbles    ,
+    output var logic [Constants::WIDTH-1:0] rom_reads
+);
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            cycle_count <= 0;
+            instret     <= 0;
+            bubbles     <= 0;
+            rom_reads   <= 0;
+        end else if (ce) begin
+            cycle_count <= cycle_count + 1;
+            instret     <= instret + {31'b0, valid} + {31'b0, lane1_valid};
+            bubbles     <= bubbles + {31'b0, bubble};
+            rom_reads   <= rom_reads + {31'b0, rom_read};
+        end
+    end
+endmodule
+
+// Does the work of the .data copy and .bss clear loops of start.s right out
+// of reset, one word per cycle. The image of .data sits in ROM at
+// DATA_SOURCE, the addresses are the linker symbols _sdata, _edata, _sbss and
+// _ebss. Snooped stores keep the RAM write port, the initializer waits for
+// them.
+module ram_initializer #(
+    parameter int unsigned DATA_SOURCE = 0,
+    parameter int unsigned DATA_START  = 0,
+    parameter int unsigned DATA_END    = 0,
+    parameter int unsigned BSS_START   = 0,
+    parameter int unsigned BSS_END     = 0
+) (
+    input var logic clk ,
+    input var logic nrst,
+
+    input var logic [Constants::BYTE-1:0] rom [0:Constants::ROM_SIZE-1],
+    input var logic                       snoop_store,
+
+    output var logic                        busy         ,
+    output var logic                        write        ,
+    output var logic [Constants::WIDTH-1:0] write_address,
+    output var logic [Constants::WIDTH-1:0] write_word
+);
+    localparam int unsigned DATA_WORDS = (DATA_END - DATA_START) / 4;
+    localparam int unsigned BSS_WORDS  = (BSS_END - BSS_START) / 4;
+
+    int unsigned                 step  ;
+    logic [Constants::WIDTH-1:0] source;
+    always_comb begin
+        busy   = step < (DATA_WORDS + BSS_WORDS);
+        write  = busy && !snoop_store;
+        source = DATA_SOURCE + (step * 4);
+        if (step < DATA_WORDS) begin
+            write_address = DATA_START + (step * 4);
+            write_word    = {
+                rom[source + 0],
+                rom[source + 1],
+                rom[source + 2],
+                rom[source + 3]
+            };
+        end else begin
+            write_address = BSS_START + ((step - DATA_WORDS) * 4);
+            write_word    = 0;
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            step <= 0;
+        end else if (write) begin
+            step <= step + 1;
+        end
+    end
+endmodule
+
+module mips_r2000 #(
+    parameter int unsigned CORE_ID               = 0,
+    parameter int unsigned THREAD_COUNT          = 1,
+    parameter int unsigned ISSUE_WIDTH           = 1,
+    parameter bit          REGISTERED_REDIRECT   = 0,
+    parameter int unsigned LOOP_BUFFER_SIZE      = 0,
+    parameter int unsigned PREFETCH_DEPTH        = 0,
+    parameter int unsigned DATA_PREFETCH_ENTRIES = 0,
+    parameter bit          EXTERNAL_MEMORY       = 0,
+    parameter bit          DMA_ENGINE            = 0,
+    parameter bit          CP0                   = 0,
+    parameter bit          TIMER                 = 0,
+    parameter bit          MULTIPLY_ACCUMULATE   = 0,
+    parameter bit          ACCELERATOR           = 0,
+    parameter int unsigned INIT_DATA_SOURCE      = 0,
+    parameter int unsigned INIT_DATA_START       = 0,
+    parameter int unsigned INIT_DATA_END         = 0,
+    parameter int unsigned INIT_BSS_START        = 0,
+    parameter int unsigned INIT_BSS_END          = 0
+) (
     input  var logic                        clk                ,
     input  var logic                        nrst               ,
+    input  var logic                        ce                 ,
     input  var logic [Constants::BYTE-1:0]  rom     [0:Constants::ROM_SIZE-1],
     input  var logic                        stall              ,
+    input  var logic                        console_tx_ready   ,
+    input  var logic [6-1:0]                interrupts         ,
 
+    input var logic                        snoop_store                    ,
+    input var logic [2-1:0]                snoop_load_store_data_size_mode,
+    input var logic [Constants::WIDTH-1:0] snoop_address                  ,
+    input var logic [Constants::WIDTH-1:0] snoop_write_data               ,
+
+    input var logic                        instruction_request_ready ,
+    input var logic                        instruction_response_valid,
+    input var logic [Constants::WIDTH-1:0] instruction_response_data ,
+    input var logic                        data_request_ready        ,
+    input var logic                        data_response_valid       ,
+    input var logic [Constants::WIDTH-1:0] data_response_data        ,
+
+    output var logic                                 valid_wb     ,
     output var logic [Constants::WIDTH-1:0]          pc_wb        ,
     output var logic [Constants::BYTE-1:0] ram [0:Constants::RAM_SIZE-1],
     output var logic                                 rd_wb        ,
     output var logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb,
     output var logic [Constants::WIDTH-1:0]          rd_data_wb,
-    output var logic [Constants::WIDTH-1:0] reg_file [0:Constants::REG_COUNT - 1-1]
+    output var logic [Constants::WIDTH-1:0] reg_file [0:Constants::REG_COUNT - 1-1],
+    output var logic                                 idle,
+    output var logic                                 tohost,
+    output var logic [Constants::WIDTH-1:0]          tohost_data,
+    output var logic                                 console_tx,
+    output var logic [Constants::BYTE-1:0]           console_tx_data,
+    output var logic [Constants::WIDTH-1:0]          cycle_count,
+    output var logic [Constants::WIDTH-1:0]          instret,
+    output var logic [Constants::WIDTH-1:0]          bubbles,
+    output var logic [Constants::WIDTH-1:0]          rom_reads,
+    output var logic [Constants::WIDTH-1:0]          prefetch_issued,
+    output var logic [Constants::WIDTH-1:0]          prefetch_used,
+    output var logic [Constants::WIDTH-1:0]          prefetch_discarded,
+    output var logic [Constants::WIDTH-1:0]          data_loads,
+    output var logic [Constants::WIDTH-1:0]          data_prefetch_issued,
+    output var logic [Constants::WIDTH-1:0]          data_prefetch_useful,
+    output var logic                                 instruction_request_valid       ,
+    output var logic [Constants::WIDTH-1:0]          instruction_request_address     ,
+    output var logic                                 data_request                    ,
+    output var logic                                 data_store                      ,
+    output var logic [2-1:0]                         data_load_store_data_size_mode  ,
+    output var logic [Constants::WIDTH-1:0]          data_address                    ,
+    output var logic [Constants::WIDTH-1:0]          data_write_data
 );
+    // The external ports, the fetch side helpers and CP0 only exist for a
+    // scalar single thread core, other combinations are rejected here rather
+    // than elaborated without the feature.
+    if (EXTERNAL_MEMORY && (REGISTERED_REDIRECT || (THREAD_COUNT != 1) || (ISSUE_WIDTH != 1))) begin : external_memory_check
+        $error("EXTERNAL_MEMORY needs THREAD_COUNT=1, ISSUE_WIDTH=1 and REGISTERED_REDIRECT=0");
+    end
+    if (REGISTERED_REDIRECT && (THREAD_COUNT != 1)) begin : registered_redirect_check
+        $error("REGISTERED_REDIRECT needs THREAD_COUNT=1");
+    end
+    if ((PREFETCH_DEPTH != 0) && !EXTERNAL_MEMORY) begin : prefetch_check
+        $error("PREFETCH_DEPTH needs EXTERNAL_MEMORY, the ROM answers every fetch in the same cycle");
+    end
+    if ((LOOP_BUFFER_SIZE != 0) && ((THREAD_COUNT != 1) || (ISSUE_WIDTH != 1))) begin : loop_buffer_check
+        $error("LOOP_BUFFER_SIZE needs THREAD_COUNT=1 and ISSUE_WIDTH=1");
+    end
+    if (CP0 && ((THREAD_COUNT != 1) || (ISSUE_WIDTH != 1))) begin : cp0_check
+        $error("CP0 needs THREAD_COUNT=1 and ISSUE_WIDTH=1");
+    end
+    // An exception redirects fetch straight out of EX and cancels the word in
+    // IF, neither the registered redirect nor the predicted loop branch of the
+    // loop buffer know about it.
+    if (CP0 && REGISTERED_REDIRECT) begin : cp0_registered_redirect_check
+        $error("CP0 cannot be combined with REGISTERED_REDIRECT");
+    end
+    if (CP0 && (LOOP_BUFFER_SIZE != 0)) begin : cp0_loop_buffer_check
+        $error("CP0 cannot be combined with LOOP_BUFFER_SIZE");
+    end
+    // The timer interrupt goes to CP0, without it nothing ever takes it.
+    if (TIMER && !CP0) begin : timer_check
+        $error("TIMER needs CP0");
+    end
+    if ((DATA_PREFETCH_ENTRIES != 0) && !EXTERNAL_MEMORY) begin : data_prefetch_check
+        $error("DATA_PREFETCH_ENTRIES needs EXTERNAL_MEMORY, the RAM answers every load in the same cycle");
+    end
+    if (DMA_ENGINE && EXTERNAL_MEMORY) begin : dma_check
+        $error("DMA_ENGINE works on the internal RAM and cannot be combined with EXTERNAL_MEMORY");
+    end
+
+    // In barrel mode the core only halts once every thread is idle or has
+    // exited, threads that are done keep their issue slots.
+    var logic [THREAD_COUNT-1:0] idle_threads  ;
+    var logic [THREAD_COUNT-1:0] tohost_threads;
+    var logic                    halted        ;
+    var logic                    initializing  ;
+    var logic                    ce_running    ;
+    always_comb begin
+        idle       = &idle_threads;
+        tohost     = &tohost_threads;
+        halted     = &(idle_threads | tohost_threads);
+        ce_running = ce & ~halted & ~initializing;
+    end
+
+    // The pipeline stays in its reset state until RAM is initialized, the
+    // initializer writes through the snoop port of the RAM.
+    var logic                        init_write        ;
+    var logic [Constants::WIDTH-1:0] init_write_address;
+    var logic [Constants::WIDTH-1:0] init_write_word   ;
+    if ((INIT_DATA_END != INIT_DATA_START) || (INIT_BSS_END != INIT_BSS_START)) begin : ram_init
+        ram_initializer #(
+            .DATA_SOURCE (INIT_DATA_SOURCE),
+            .DATA_START  (INIT_DATA_START ),
+            .DATA_END    (INIT_DATA_END   ),
+            .BSS_START   (INIT_BSS_START  ),
+            .BSS_END     (INIT_BSS_END    )
+        ) ram_initializer_inst (
+            .clk  (clk ),
+            .nrst (nrst),
+            .
+            rom          (rom        ),
+            .snoop_store (snoop_store),
+            .
+            busy           (initializing      ),
+            .write         (init_write        ),
+            .write_address (init_write_address),
+            .write_word    (init_write_word   )
+        );
+    end else begin : no_ram_init
+        always_comb begin
+            initializing       = 0;
+            init_write         = 0;
+            init_write_address = 0;
+            init_write_word    = 0;
+        end
+    end
+
+    var logic                        ram_snoop_store                    ;
+    var logic [2-1:0]                ram_snoop_load_store_data_size_mode;
+    var logic [Constants::WIDTH-1:0] ram_snoop_address                  ;
+    var logic [Constants::WIDTH-1:0] ram_snoop_write_data               ;
+    always_comb begin
+        if (init_write) begin
+            ram_snoop_store                     = 1;
+            ram_snoop_load_store_data_size_mode = Decode::LoadStoreDataSizeMode_WORD;
+            ram_snoop_address                   = init_write_address;
+            ram_snoop_write_data                = init_write_word;
+        end else begin
+            ram_snoop_store                     = snoop_store;
+            ram_snoop_load_store_data_size_mode = snoop_load_store_data_size_mode;
+            ram_snoop_address                   = snoop_address;
+            ram_snoop_write_data                = snoop_write_data;
+        end
+    end
+
+    var logic                                 valid_ex     ;
+    var logic [Constants::THREAD_ID_WIDTH-1:0] thread_wb   ;
+    var logic                                 data_busy_ex   ;
+    var logic                                 data_request_ex;
+    var logic                                 data_store_ex  ;
     var logic                                 load_me      ;
     var logic [Constants::WIDTH-1:0]          read_data_me ;
     var logic                                 alu_mode_me  ;
     var logic [Constants::WIDTH-1:0]          alu_result_me;
+    var logic                                 rom_read_if  ;
 
-    memory memory_inst (
+    var logic                                 lane1_valid_ex     ;
+    var logic [Constants::WIDTH-1:0]          lane1_pc_wb        ;
+    var logic                                 lane1_alu_mode_me  ;
+    var logic [Constants::WIDTH-1:0]          lane1_alu_result_me;
+    var logic                                 lane1_rd_wb        ;
+    var logic [Constants::REG_ADDR_WIDTH-1:0] lane1_rd_address_wb;
+    var logic [Constants::WIDTH-1:0]          lane1_rd_data_wb   ;
+
+    memory #(
+        .CORE_ID               (CORE_ID              ),
+        .THREAD_COUNT          (THREAD_COUNT         ),
+        .ISSUE_WIDTH           (ISSUE_WIDTH          ),
+        .REGISTERED_REDIRECT   (REGISTERED_REDIRECT  ),
+        .LOOP_BUFFER_SIZE      (LOOP_BUFFER_SIZE     ),
+        .PREFETCH_DEPTH        (PREFETCH_DEPTH       ),
+        .DATA_PREFETCH_ENTRIES (DATA_PREFETCH_ENTRIES),
+        .EXTERNAL_MEMORY       (EXTERNAL_MEMORY      ),
+        .DMA_ENGINE            (DMA_ENGINE           ),
+        .CP0                   (CP0                  ),
+        .TIMER                 (TIMER                ),
+        .MULTIPLY_ACCUMULATE   (MULTIPLY_ACCUMULATE  ),
+        .ACCELERATOR           (ACCELERATOR          )
+    ) memory_inst (
         .clk(clk),
         .nrst(nrst),
+        .ce(ce_running),
         .rom(rom),
         .stall(stall),
+        .console_tx_ready(console_tx_ready),
+        .interrupts(interrupts),
+
+        .snoop_store(ram_snoop_store),
+        .snoop_load_store_data_size_mode(ram_snoop_load_store_data_size_mode),
+        .snoop_address(ram_snoop_address),
+        .snoop_write_data(ram_snoop_write_data),
 
+        .instruction_request_ready_if(instruction_request_ready),
+        .instruction_response_valid_if(instruction_response_valid),
+        .instruction_response_data_if(instruction_response_data),
+        .data_request_ready_ex(data_request_ready),
+        .data_response_valid_ex(data_response_valid),
+        .data_response_data_ex(data_response_data),
+
+        .thread_wb(thread_wb),
         .rd_wb(rd_wb),
         .rd_address_wb(rd_address_wb),
         .rd_data_wb(rd_data_wb),
 
+        .lane1_rd_wb(lane1_rd_wb),
+        .lane1_rd_address_wb(lane1_rd_address_wb),
+        .lane1_rd_data_wb(lane1_rd_data_wb),
+
+        .valid_ex(valid_ex),
+        .valid_me(valid_wb),
+        .thread_me(thread_wb),
         .pc_me(pc_wb),
         .ram(ram),
         .load_me(load_me),
@@ -52,9 +347,60 @@ module mips_r2000 (
         .alu_result_me(alu_result_me),
         .rd_me(rd_wb),
         .rd_address_me(rd_address_wb),
+        .idle_ex(idle_threads),
+        .rom_read_if(rom_read_if),
+        .prefetch_issued_if(prefetch_issued),
+        .prefetch_used_if(prefetch_used),
+        .prefetch_discarded_if(prefetch_discarded),
+        .data_loads_ex(data_loads),
+        .data_prefetch_issued_ex(data_prefetch_issued),
+        .data_prefetch_useful_ex(data_prefetch_useful),
+        .tohost_me(tohost_threads),
+        .tohost_data_me(tohost_data),
+        .console_tx_me(console_tx),
+        .console_tx_data_me(console_tx_data),
+        .instruction_request_valid_if(instruction_request_valid),
+        .instruction_request_address_if(instruction_request_address),
+        .data_busy_ex(data_busy_ex),
+        .data_request_ex(data_request_ex),
+        .data_store_ex(data_store_ex),
+        .data_load_store_data_size_mode_ex(data_load_store_data_size_mode),
+        .data_address_ex(data_address),
+        .data_write_data_ex(data_write_data),
+
+        .lane1_valid_ex(lane1_valid_ex),
+        .lane1_pc_me(lane1_pc_wb),
+        .lane1_alu_mode_me(lane1_alu_mode_me),
+        .lane1_alu_result_me(lane1_alu_result_me),
+        .lane1_rd_me(lane1_rd_wb),
+        .lane1_rd_address_me(lane1_rd_address_wb),
         .reg_file(reg_file)
     );
 
+    always_comb begin
+        data_request = data_request_ex & ~halted;
+        data_store   = data_store_ex & ce_running;
+    end
+
+    // Instructions retire as they enter writeback, so the store that
+    // halts the core on tohost is still counted. One waiting on the data
+    // port only retires once its response arrived, a cycle in which
+    // nothing retires for lack of an instruction is a bubble.
+    performance_counters performance_counters_inst (
+        .clk         (clk                            ),
+        .nrst        (nrst                           ),
+        .ce          (ce_running                     ),
+        .valid       (valid_ex && !data_busy_ex      ),
+        .lane1_valid (lane1_valid_ex && !data_busy_ex),
+        .bubble      (!valid_ex                      ),
+        .rom_read    (rom_read_if                    ),
+        .
+        cycle_count (cycle_count),
+        .instret    (instret    ),
+        .bubbles    (bubbles    ),
+        .rom_reads  (rom_reads  )
+    );
+
     writeback writeback_inst (
         .load(load_me),
         .alu_mode(alu_mode_me),
@@ -63,4 +409,13 @@ module mips_r2000 (
 
         .rd_data_wb(rd_data_wb)
     );
+
+    writeback lane1_writeback_inst (
+        .load(1'b0),
+        .alu_mode(lane1_alu_mode_me),
+        .read_data(32'h0000_0000),
+        .alu_result(lane1_alu_result_me),
+
+        .rd_data_wb(lane1_rd_data_wb)
+    );
 endmodule
\ No newline at end of file
@@ -0,0 +1,500 @@
+// Turns the instruction port of the core into an AXI4 read master. Words
+// come from a line buffer, a miss refills the whole line with one INCR burst
+// and a request for a word that already arrived is served while the rest of
+// the burst is still coming in. A SLVERR or DECERR beat sets error until
+// reset, the word itself is still handed to fetch.
+module axi_instruction_master #(
+    parameter int unsigned LINE_WORDS = 4
+) (
+    input var logic clk ,
+    input var logic nrst,
+
+    input  var logic                        request_valid  ,
+    input  var logic [Constants::WIDTH-1:0] request_address,
+    output var logic                        request_ready  ,
+    output var logic                        response_valid ,
+    output var logic [Constants::WIDTH-1:0] response_data  ,
+    output var logic                        error          ,
+
+    output var logic                        arvalid,
+    input  var logic                        arready,
+    output var logic [Constants::WIDTH-1:0] araddr ,
+    output var logic [8-1:0]                arlen  ,
+    output var logic [3-1:0]                arsize ,
+    output var logic [2-1:0]                arburst,
+    input  var logic                        rvalid ,
+    output var logic                        rready ,
+    input  var logic [Constants::WIDTH-1:0] rdata  ,
+    input  var logic [2-1:0]                rresp  ,
+    input  var logic                        rlast
+);
+    localparam logic [Constants::WIDTH-1:0] LINE_MASK = ~(LINE_WORDS * 4 - 1);
+
+    logic [Constants::WIDTH-1:0] line [0:LINE_WORDS-1];
+    logic [Constants::WIDTH-1:0] line_address   ;
+    logic [LINE_WORDS-1:0]       filled         ;
+    logic                        refilling      ;
+    int unsigned                 fill_index     ;
+    logic                        pending        ;
+    logic [Constants::WIDTH-1:0] pending_address;
+
+    logic                        request_hit;
+    logic                        pending_hit;
+    logic [Constants::WIDTH-1:0] beat       ;
+    always_comb begin
+        request_hit   = ((request_address & LINE_MASK) == line_address) && filled[(request_address / 4) % LINE_WORDS];
+        pending_hit   = ((pending_address & LINE_MASK) == line_address) && filled[(pending_address / 4) % LINE_WORDS];
+        request_ready = !pending;
+        rready        = 1;
+        arlen         = LINE_WORDS - 1;
+        arsize        = 3'b010;
+        arburst       = 2'b01;
+        // AXI puts the byte at the lowest address on the lowest lane, the
+        // core reads its words big endian.
+        beat          = { rdata[7:0], rdata[15:8], rdata[23:16], rdata[31:24] };
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            for (int unsigned i = 0; i < LINE_WORDS; i++) begin
+                line[i] <= 0;
+            end
+            line_address    <= 0;
+            filled          <= 0;
+            refilling       <= 0;
+            fill_index      <= 0;
+            pending         <= 0;
+            pending_address <= 0;
+            response_valid  <= 0;
+            response_data   <= 0;
+            arvalid         <= 0;
+            araddr          <= 0;
+            error           <= 0;
+        end else begin
+            response_valid <= 0;
+            if (rvalid && rready && rresp[1]) begin
+                error <= 1;
+            end
+            if (request_valid && request_ready) begin
+                if (request_hit) begin
+                    response_valid <= 1;
+                    response_data  <= line[(request_address / 4) % LINE_WORDS];
+                end else begin
+                    pending         <= 1;
+                    pending_address <= request_address;
+                end
+            end else if (pending && pending_hit) begin
+                pending        <= 0;
+                response_valid <= 1;
+                response_data  <= line[(pending_address / 4) % LINE_WORDS];
+            end
+
+            if (arvalid && arready) begin
+                arvalid <= 0;
+            end
+
+            // A burst that was started always runs to its last beat, even
+            // if fetch has moved on meanwhile.
+            if (pending && !pending_hit && !refilling) begin
+                refilling    <= 1;
+                arvalid      <= 1;
+                araddr       <= pending_address & LINE_MASK;
+                line_address <= pending_address & LINE_MASK;
+                filled       <= 0;
+                fill_index   <= 0;
+            end else if (refilling && rvalid) begin
+                line[fill_index]   <= beat;
+                filled[fill_index] <= 1;
+                fill_index         <= (fill_index + 1) % LINE_WORDS;
+                if (rlast) begin
+                    refilling <= 0;
+                end
+            end
+        end
+    end
+endmodule
+
+// Turns the data port of the core into an AXI4 master with single beat
+// transfers. Stores are posted, the core moves on as soon as the write is
+// handed to the bus and up to WRITE_DEPTH of them may wait for their write
+// response. A load is only issued once every earlier write was answered, as
+// AXI does not order reads against writes. Like on the instruction side an
+// error response on the read or the write channel sets error until reset.
+module axi_data_master #(
+    parameter int unsigned WRITE_DEPTH = 4
+) (
+    input var logic clk ,
+    input var logic nrst,
+
+    input  var logic                        request_valid                    ,
+    input  var logic                        request_store                    ,
+    input  var logic [2-1:0]                request_load_store_data_size_mode,
+    input  var logic [Constants::WIDTH-1:0] request_address                  ,
+    input  var logic [Constants::WIDTH-1:0] request_write_data               ,
+    output var logic                        request_ready                    ,
+    output var logic                        response_valid                   ,
+    output var logic [Constants::WIDTH-1:0] response_data                    ,
+    output var logic                        idle                             ,
+    output var logic                        error                            ,
+
+    output var logic                        arvalid,
+    input  var logic                        arready,
+    output var logic [Constants::WIDTH-1:0] araddr ,
+    output var logic [8-1:0]                arlen  ,
+    output var logic [3-1:0]                arsize ,
+    output var logic [2-1:0]                arburst,
+    input  var logic                        rvalid ,
+    output var logic                        rready ,
+    input  var logic [Constants::WIDTH-1:0] rdata  ,
+    input  var logic [2-1:0]                rresp  ,
+    input  var logic                        rlast  ,
+
+    output var logic                        awvalid,
+    input  var logic                        awready,
+    output var logic [Constants::WIDTH-1:0] awaddr ,
+    output var logic [8-1:0]                awlen  ,
+    output var logic [3-1:0]                awsize ,
+    output var logic [2-1:0]                awburst,
+    output var logic                        wvalid ,
+    input  var logic                        wready ,
+    output var logic [Constants::WIDTH-1:0] wdata  ,
+    output var logic [4-1:0]                wstrb  ,
+    output var logic                        wlast  ,
+    input  var logic                        bvalid ,
+    output var logic                        bready ,
+    input  var logic [2-1:0]                bresp
+);
+    logic                        reading  ;
+    logic [2-1:0]                read_lane;
+    int unsigned                 writes   ;
+
+    // Like data_memory a byte access uses the byte at address + 3 and a half
+    // word the two from address + 2 on, the access always ends on the lane
+    // of address + 3.
+    logic [Constants::WIDTH-1:0] address      ;
+    logic [3-1:0]                size         ;
+    logic [4-1:0]                strobe       ;
+    logic [2-1:0]                last_lane    ;
+    logic [Constants::WIDTH-1:0] shifted_write;
+    logic [Constants::WIDTH-1:0] read_word    ;
+    always_comb begin
+        last_lane = request_address[1:0] + 2'd3;
+        address   = request_address;
+        size      = 3'b010;
+        strobe    = 4'b1111;
+        if (request_load_store_data_size_mode == Decode::LoadStoreDataSizeMode_BYTE) begin
+            address = request_address + 3;
+            size    = 3'b000;
+            strobe  = 4'b0001 << address[1:0];
+        end else if (request_load_store_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) begin
+            address = request_address + 2;
+            size    = 3'b001;
+            strobe  = 4'b0011 << address[1:0];
+        end
+
+        shifted_write = request_write_data << {2'd3 - last_lane, 3'b000};
+        read_word     = { rdata[7:0], rdata[15:8], rdata[23:16], rdata[31:24] } >> {2'd3 - read_lane, 3'b000};
+
+        request_ready = !arvalid && !reading && !awvalid && !wvalid && (request_store ? (writes < WRITE_DEPTH) : (writes == 0));
+        idle          = !arvalid && !reading && (writes == 0);
+        rready        = 1;
+        bready        = 1;
+        arlen         = 0;
+        arburst       = 2'b01;
+        awlen         = 0;
+        awburst       = 2'b01;
+        wlast         = 1;
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            reading        <= 0;
+            read_lane      <= 0;
+            writes         <= 0;
+            response_valid <= 0;
+            response_data  <= 0;
+            arvalid        <= 0;
+            araddr         <= 0;
+            arsize         <= 0;
+            awvalid        <= 0;
+            awaddr         <= 0;
+            awsize         <= 0;
+            wvalid         <= 0;
+            wdata          <= 0;
+            wstrb          <= 0;
+            error          <= 0;
+        end else begin
+            response_valid <= 0;
+            if ((rvalid && rready && rresp[1]) || (bvalid && bready && bresp[1])) begin
+                error <= 1;
+            end
+            if (request_valid && request_ready) begin
+                if (request_store) begin
+                    awvalid        <= 1;
+                    awaddr         <= address;
+                    awsize         <= size;
+                    wvalid         <= 1;
+                    wdata          <= { shifted_write[7:0], shifted_write[15:8], shifted_write[23:16], shifted_write[31:24] };
+                    wstrb          <= strobe;
+                    response_valid <= 1;
+                    response_data  <= 0;
+                end else begin
+                    arvalid   <= 1;
+                    araddr    <= address;
+                    arsize    <= size;
+                    reading   <= 1;
+                    read_lane <= last_lane;
+                end
+            end else if (reading && rvalid) begin
+                reading        <= 0;
+                response_valid <= 1;
+                response_data  <= read_word;
+            end
+
+            if (arvalid && arready) begin
+                arvalid <= 0;
+            end
+            if (awvalid && awready) begin
+                awvalid <= 0;
+            end
+            if (wvalid && wready) begin
+                wvalid <= 0;
+            end
+
+            writes <= writes + ((request_valid && request_ready && request_store) ? 1 : 0) - (bvalid ? 1 : 0);
+        end
+    end
+endmodule
+
+// The core with its instruction and data ports on AXI4 masters, to be
+// dropped onto an interconnect in front of shared memory. tohost only rises
+// once every posted store of the program was answered. bus_error stays set
+// once either master saw an error response.
+module mips_r2000_axi #(
+    parameter int unsigned CORE_ID     = 0,
+    parameter int unsigned LINE_WORDS  = 4,
+    parameter int unsigned WRITE_DEPTH = 4
+) (
+    input  var logic clk             ,
+    input  var logic nrst            ,
+    input  var logic console_tx_ready,
+
+    output var logic                        instruction_arvalid,
+    input  var logic                        instruction_arready,
+    output var logic [Constants::WIDTH-1:0] instruction_araddr ,
+    output var logic [8-1:0]                instruction_arlen  ,
+    output var logic [3-1:0]                instruction_arsize ,
+    output var logic [2-1:0]                instruction_arburst,
+    input  var logic                        instruction_rvalid ,
+    output var logic                        instruction_rready ,
+    input  var logic [Constants::WIDTH-1:0] instruction_rdata  ,
+    input  var logic [2-1:0]                instruction_rresp  ,
+    input  var logic                        instruction_rlast  ,
+
+    output var logic                        data_arvalid,
+    input  var logic                        data_arready,
+    output var logic [Constants::WIDTH-1:0] data_araddr ,
+    output var logic [8-1:0]                data_arlen  ,
+    output var logic [3-1:0]                data_arsize ,
+    output var logic [2-1:0]                data_arburst,
+    input  var logic                        data_rvalid ,
+    output var logic                        data_rready ,
+    input  var logic [Constants::WIDTH-1:0] data_rdata  ,
+    input  var logic [2-1:0]                data_rresp  ,
+    input  var logic                        data_rlast  ,
+    output var logic                        data_awvalid,
+    input  var logic                        data_awready,
+    output var logic [Constants::WIDTH-1:0] data_awaddr ,
+    output var logic [8-1:0]                data_awlen  ,
+    output var logic [3-1:0]                data_awsize ,
+    output var logic [2-1:0]                data_awburst,
+    output var logic                        data_wvalid ,
+    input  var logic                        data_wready ,
+    output var logic [Constants::WIDTH-1:0] data_wdata  ,
+    output var logic [4-1:0]                data_wstrb  ,
+    output var logic                        data_wlast  ,
+    input  var logic                        data_bvalid ,
+    output var logic                        data_bready ,
+    input  var logic [2-1:0]                data_bresp  ,
+
+    output var logic                        valid_wb       ,
+    output var logic [Constants::WIDTH-1:0] pc_wb          ,
+    output var logic                        idle           ,
+    output var logic                        tohost         ,
+    output var logic [Constants::WIDTH-1:0] tohost_data    ,
+    output var logic                        console_tx     ,
+    output var logic [Constants::BYTE-1:0]  console_tx_data,
+    output var logic [Constants::WIDTH-1:0] cycle_count    ,
+    output var logic [Constants::WIDTH-1:0] instret        ,
+    output var logic                        bus_error
+);
+    logic [Constants::BYTE-1:0] rom [0:Constants::ROM_SIZE-1];
+    always_comb begin
+        for (int unsigned i = 0; i < Constants::ROM_SIZE; i++) begin
+            rom[i] = 0;
+        end
+    end
+
+    logic                        instruction_request_ready ;
+    logic                        instruction_response_valid;
+    logic [Constants::WIDTH-1:0] instruction_response_data ;
+    logic                        data_request_ready        ;
+    logic                        data_response_valid       ;
+    logic [Constants::WIDTH-1:0] data_response_data        ;
+
+    logic [Constants::BYTE-1:0]           ram [0:Constants::RAM_SIZE-1];
+    logic                                 rd_wb;
+    logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb;
+    logic [Constants::WIDTH-1:0]          rd_data_wb;
+    logic [Constants::WIDTH-1:0]          reg_file [0:Constants::REG_COUNT-1-1];
+    logic                                 core_tohost;
+    logic [Constants::WIDTH-1:0]          bubbles;
+    logic [Constants::WIDTH-1:0]          rom_reads;
+    logic [Constants::WIDTH-1:0]          prefetch_issued;
+    logic [Constants::WIDTH-1:0]          prefetch_used;
+    logic [Constants::WIDTH-1:0]          prefetch_discarded;
+    logic [Constants::WIDTH-1:0]          data_loads;
+    logic [Constants::WIDTH-1:0]          data_prefetch_issued;
+    logic [Constants::WIDTH-1:0]          data_prefetch_useful;
+    logic                                 instruction_request_valid;
+    logic [Constants::WIDTH-1:0]          instruction_request_address;
+    logic                                 data_request;
+    logic                                 data_store;
+    logic [2-1:0]                         data_load_store_data_size_mode;
+    logic [Constants::WIDTH-1:0]          data_address;
+    logic [Constants::WIDTH-1:0]          data_write_data;
+
+    mips_r2000 #(
+        .CORE_ID(CORE_ID),
+        .EXTERNAL_MEMORY(1)
+    ) mips_r2000_inst (
+        .clk(clk),
+        .nrst(nrst),
+        .ce(1'b1),
+        .rom(rom),
+        .stall(1'b0),
+        .console_tx_ready(console_tx_ready),
+        .interrupts(6'b00_0000),
+
+        .snoop_store(1'b0),
+        .snoop_load_store_data_size_mode(2'b00),
+        .snoop_address(32'h0000_0000),
+        .snoop_write_data(32'h0000_0000),
+
+        .instruction_request_ready(instruction_request_ready),
+        .instruction_response_valid(instruction_response_valid),
+        .instruction_response_data(instruction_response_data),
+        .data_request_ready(data_request_ready),
+        .data_response_valid(data_response_valid),
+        .data_response_data(data_response_data),
+
+        .valid_wb(valid_wb),
+        .pc_wb(pc_wb),
+        .ram(ram),
+        .rd_wb(rd_wb),
+        .rd_address_wb(rd_address_wb),
+        .rd_data_wb(rd_data_wb),
+        .reg_file(reg_file),
+        .idle(idle),
+        .tohost(core_tohost),
+        .tohost_data(tohost_data),
+        .console_tx(console_tx),
+        .console_tx_data(console_tx_data),
+        .cycle_count(cycle_count),
+        .instret(instret),
+        .bubbles(bubbles),
+        .rom_reads(rom_reads),
+        .prefetch_issued(prefetch_issued),
+        .prefetch_used(prefetch_used),
+        .prefetch_discarded(prefetch_discarded),
+        .data_loads(data_loads),
+        .data_prefetch_issued(data_prefetch_issued),
+        .data_prefetch_useful(data_prefetch_useful),
+        .instruction_request_valid(instruction_request_valid),
+        .instruction_request_address(instruction_request_address),
+        .data_request(data_request),
+        .data_store(data_store),
+        .data_load_store_data_size_mode(data_load_store_data_size_mode),
+        .data_address(data_address),
+        .data_write_data(data_write_data)
+    );
+
+    logic instruction_error;
+    axi_instruction_master #(
+        .LINE_WORDS(LINE_WORDS)
+    ) axi_instruction_master_inst (
+        .clk  (clk ),
+        .nrst (nrst),
+        .
+        request_valid   (instruction_request_valid  ),
+        .request_address (instruction_request_address),
+        .request_ready   (instruction_request_ready  ),
+        .response_valid  (instruction_response_valid ),
+        .response_data   (instruction_response_data  ),
+        .error           (instruction_error          ),
+        .
+        arvalid  (instruction_arvalid),
+        .arready (instruction_arready),
+        .araddr  (instruction_araddr ),
+        .arlen   (instruction_arlen  ),
+        .arsize  (instruction_arsize ),
+        .arburst (instruction_arburst),
+        .rvalid  (instruction_rvalid ),
+        .rready  (instruction_rready ),
+        .rdata   (instruction_rdata  ),
+        .rresp   (instruction_rresp  ),
+        .rlast   (instruction_rlast  )
+    );
+
+    logic data_idle ;
+    logic data_error;
+    axi_data_master #(
+        .WRITE_DEPTH(WRITE_DEPTH)
+    ) axi_data_master_inst (
+        .clk  (clk ),
+        .nrst (nrst),
+        .
+        request_valid                      (data_request                  ),
+        .request_store                     (data_store                    ),
+        .request_load_store_data_size_mode (data_load_store_data_size_mode),
+        .request_address                   (data_address                  ),
+        .request_write_data                (data_write_data               ),
+        .request_ready                     (data_request_ready            ),
+        .response_valid                    (data_response_valid           ),
+        .response_data                     (data_response_data            ),
+        .idle                              (data_idle                     ),
+        .error                             (data_error                    ),
+        .
+        arvalid  (data_arvalid),
+        .arready (data_arready),
+        .araddr  (data_araddr ),
+        .arlen   (data_arlen  ),
+        .arsize  (data_arsize ),
+        .arburst (data_arburst),
+        .rvalid  (data_rvalid ),
+        .rready  (data_rready ),
+        .rdata   (data_rdata  ),
+        .rresp   (data_rresp  ),
+        .rlast   (data_rlast  ),
+        .
+        awvalid  (data_awvalid),
+        .awready (data_awready),
+        .awaddr  (data_awaddr ),
+        .awlen   (data_awlen  ),
+        .awsize  (data_awsize ),
+        .awburst (data_awburst),
+        .wvalid  (data_wvalid ),
+        .wready  (data_wready ),
+        .wdata   (data_wdata  ),
+        .wstrb   (data_wstrb  ),
+        .wlast   (data_wlast  ),
+        .bvalid  (data_bvalid ),
+        .bready  (data_bready ),
+        .bresp   (data_bresp  )
+    );
+
+    always_comb begin
+        tohost    = core_tohost && data_idle;
+        bus_error = instruction_error || data_error;
+    end
+endmodule
\ No newline at end of file
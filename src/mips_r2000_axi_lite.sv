@@ -0,0 +1,130 @@
+// The same core on AXI4-Lite, for interconnects and peripherals without
+// bursts. Instruction lines are a single word, so every fetch is one read,
+// and the burst, size and last signals of AXI4 are left off the ports. The
+// data master already uses single beats, narrow accesses only differ in
+// wstrb and the lanes the core picks out of rdata. arprot marks instruction
+// fetches.
+module mips_r2000_axi_lite #(
+    parameter int unsigned CORE_ID     = 0,
+    parameter int unsigned WRITE_DEPTH = 4
+) (
+    input  var logic clk             ,
+    input  var logic nrst            ,
+    input  var logic console_tx_ready,
+
+    output var logic                        instruction_arvalid,
+    input  var logic                        instruction_arready,
+    output var logic [Constants::WIDTH-1:0] instruction_araddr ,
+    output var logic [3-1:0]                instruction_arprot ,
+    input  var logic                        instruction_rvalid ,
+    output var logic                        instruction_rready ,
+    input  var logic [Constants::WIDTH-1:0] instruction_rdata  ,
+    input  var logic [2-1:0]                instruction_rresp  ,
+
+    output var logic                        data_arvalid,
+    input  var logic                        data_arready,
+    output var logic [Constants::WIDTH-1:0] data_araddr ,
+    output var logic [3-1:0]                data_arprot ,
+    input  var logic                        data_rvalid ,
+    output var logic                        data_rready ,
+    input  var logic [Constants::WIDTH-1:0] data_rdata  ,
+    input  var logic [2-1:0]                data_rresp  ,
+    output var logic                        data_awvalid,
+    input  var logic                        data_awready,
+    output var logic [Constants::WIDTH-1:0] data_awaddr ,
+    output var logic [3-1:0]                data_awprot ,
+    output var logic                        data_wvalid ,
+    input  var logic                        data_wready ,
+    output var logic [Constants::WIDTH-1:0] data_wdata  ,
+    output var logic [4-1:0]                data_wstrb  ,
+    input  var logic                        data_bvalid ,
+    output var logic                        data_bready ,
+    input  var logic [2-1:0]                data_bresp  ,
+
+    output var logic                        valid_wb       ,
+    output var logic [Constants::WIDTH-1:0] pc_wb          ,
+    output var logic                        idle           ,
+    output var logic                        tohost         ,
+    output var logic [Constants::WIDTH-1:0] tohost_data    ,
+    output var logic                        console_tx     ,
+    output var logic [Constants::BYTE-1:0]  console_tx_data,
+    output var logic [Constants::WIDTH-1:0] cycle_count    ,
+    output var logic [Constants::WIDTH-1:0] instret        ,
+    output var logic                        bus_error
+);
+    logic [8-1:0] instruction_arlen  ;
+    logic [3-1:0] instruction_arsize ;
+    logic [2-1:0] instruction_arburst;
+    logic [8-1:0] data_arlen         ;
+    logic [3-1:0] data_arsize        ;
+    logic [2-1:0] data_arburst       ;
+    logic [8-1:0] data_awlen         ;
+    logic [3-1:0] data_awsize        ;
+    logic [2-1:0] data_awburst       ;
+    logic         data_wlast         ;
+
+    always_comb begin
+        instruction_arprot = 3'b100;
+        data_arprot        = 3'b000;
+        data_awprot        = 3'b000;
+    end
+
+    mips_r2000_axi #(
+        .CORE_ID     (CORE_ID    ),
+        .LINE_WORDS  (1          ),
+        .WRITE_DEPTH (WRITE_DEPTH)
+    ) mips_r2000_axi_inst (
+        .clk              (clk             ),
+        .nrst             (nrst            ),
+        .console_tx_ready (console_tx_ready),
+        .
+        instruction_arvalid  (instruction_arvalid),
+        .instruction_arready (instruction_arready),
+        .instruction_araddr  (instruction_araddr ),
+        .instruction_arlen   (instruction_arlen  ),
+        .instruction_arsize  (instruction_arsize ),
+        .instruction_arburst (instruction_arburst),
+        .instruction_rvalid  (instruction_rvalid ),
+        .instruction_rready  (instruction_rready ),
+        .instruction_rdata   (instruction_rdata  ),
+        .instruction_rresp   (instruction_rresp  ),
+        .instruction_rlast   (1'b1               ),
+        .
+        data_arvalid  (data_arvalid),
+        .data_arready (data_arready),
+        .data_araddr  (data_araddr ),
+        .data_arlen   (data_arlen  ),
+        .data_arsize  (data_arsize ),
+        .data_arburst (data_arburst),
+        .data_rvalid  (data_rvalid ),
+        .data_rready  (data_rready ),
+        .data_rdata   (data_rdata  ),
+        .data_rresp   (data_rresp  ),
+        .data_rlast   (1'b1        ),
+        .data_awvalid (data_awvalid),
+        .data_awready (data_awready),
+        .data_awaddr  (data_awaddr ),
+        .data_awlen   (data_awlen  ),
+        .data_awsize  (data_awsize ),
+        .data_awburst (data_awburst),
+        .data_wvalid  (data_wvalid ),
+        .data_wready  (data_wready ),
+        .data_wdata   (data_wdata  ),
+        .data_wstrb   (data_wstrb  ),
+        .data_wlast   (data_wlast  ),
+        .data_bvalid  (data_bvalid ),
+        .data_bready  (data_bready ),
+        .data_bresp   (data_bresp  ),
+        .
+        valid_wb         (valid_wb       ),
+        .pc_wb           (pc_wb          ),
+        .idle            (idle           ),
+        .tohost          (tohost         ),
+        .tohost_data     (tohost_data    ),
+        .console_tx      (console_tx     ),
+        .console_tx_data (console_tx_data),
+        .cycle_count     (cycle_count    ),
+        .instret         (instret        ),
+        .bus_error       (bus_error      )
+    );
+endmodule
\ No newline at end of file
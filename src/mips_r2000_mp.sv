@@ -0,0 +1,187 @@
+module round_robin_arbiter #(
+    parameter int unsigned N = 2
+) (
+    input var logic clk,
+    input var logic nrst,
+
+    input  var logic [N-1:0] request,
+    output var logic [N-1:0] grant
+);
+    int unsigned first;
+
+    always_comb begin
+        grant = 0;
+        for (int unsigned i = 0; i < N; i++) begin
+            if ((grant == 0) && request[(first + i) % N]) begin
+                grant[(first + i) % N] = 1;
+            end
+        end
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            first <= 0;
+        end else begin
+            for (int unsigned i = 0; i < N; i++) begin
+                if (grant[i]) begin
+                    first <= (i + 1) % N;
+                end
+            end
+        end
+    end
+endmodule
+
+module mips_r2000_mp #(
+    parameter int unsigned CORE_COUNT = 2,
+    parameter bit          DMA_ENGINE = 0
+) (
+    input  var logic                        clk                ,
+    input  var logic                        nrst               ,
+    input  var logic [Constants::BYTE-1:0]  rom     [0:Constants::ROM_SIZE-1],
+    input  var logic [CORE_COUNT-1:0]       console_tx_ready   ,
+
+    output var logic [Constants::BYTE-1:0]  ram [0:Constants::RAM_SIZE-1],
+    output var logic [Constants::WIDTH-1:0] pc_wb           [0:CORE_COUNT-1],
+    output var logic [CORE_COUNT-1:0]       idle            ,
+    output var logic [CORE_COUNT-1:0]       tohost          ,
+    output var logic [Constants::WIDTH-1:0] tohost_data     [0:CORE_COUNT-1],
+    output var logic [CORE_COUNT-1:0]       console_tx      ,
+    output var logic [Constants::BYTE-1:0]  console_tx_data [0:CORE_COUNT-1],
+    output var logic [Constants::WIDTH-1:0] cycle_count     [0:CORE_COUNT-1],
+    output var logic [Constants::WIDTH-1:0] instret         [0:CORE_COUNT-1]
+);
+    // The DMA engine writes the RAM of its own core only, the other replicas
+    // would never see its stores.
+    if (DMA_ENGINE && (CORE_COUNT > 1)) begin : dma_check
+        $error("DMA_ENGINE is not broadcast to the other cores and needs CORE_COUNT=1");
+    end
+
+    logic [CORE_COUNT-1:0]       data_request                  ;
+    logic [CORE_COUNT-1:0]       data_store                    ;
+    logic [2-1:0]                data_load_store_data_size_mode [0:CORE_COUNT-1];
+    logic [Constants::WIDTH-1:0] data_address                  [0:CORE_COUNT-1];
+    logic [Constants::WIDTH-1:0] data_write_data               [0:CORE_COUNT-1];
+
+    // Each core keeps a replica of the data RAM, so only stores contend for
+    // the one write port every replica has. Loads read the own replica without
+    // waiting, a load next to a granted store of another core to the same
+    // word sees the old value and is ordered before that store.
+    logic [CORE_COUNT-1:0] store_request;
+    always_comb begin
+        store_request = data_request & data_store;
+    end
+
+    logic [CORE_COUNT-1:0] grant;
+    round_robin_arbiter #(
+        .N(CORE_COUNT)
+    ) round_robin_arbiter_inst (
+        .clk     (clk          ),
+        .nrst    (nrst         ),
+        .request (store_request),
+        .grant   (grant        )
+    );
+
+    // The granted store is broadcast to every core, the others apply it to
+    // their replica through the snoop port.
+    logic                        bus_store                    ;
+    logic [2-1:0]                bus_load_store_data_size_mode;
+    logic [Constants::WIDTH-1:0] bus_address                  ;
+    logic [Constants::WIDTH-1:0] bus_write_data               ;
+    always_comb begin
+        bus_store                     = 0;
+        bus_load_store_data_size_mode = 0;
+        bus_address                   = 0;
+        bus_write_data                = 0;
+        for (int unsigned i = 0; i < CORE_COUNT; i++) begin
+            if (grant[i]) begin
+                bus_store                     = data_store[i];
+                bus_load_store_data_size_mode = data_load_store_data_size_mode[i];
+                bus_address                   = data_address[i];
+                bus_write_data                = data_write_data[i];
+            end
+        end
+    end
+
+    for (genvar i = 0; i < CORE_COUNT; i++) begin : cores
+        logic                                 ce;
+        logic [Constants::BYTE-1:0]           ram_replica [0:Constants::RAM_SIZE-1];
+        logic                                 rd_wb;
+        logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb;
+        logic [Constants::WIDTH-1:0]          rd_data_wb;
+        logic [Constants::WIDTH-1:0]          reg_file [0:Constants::REG_COUNT-1-1];
+        logic                                 valid_wb;
+        logic [Constants::WIDTH-1:0]          bubbles;
+        logic [Constants::WIDTH-1:0]          rom_reads;
+        logic [Constants::WIDTH-1:0]          prefetch_issued;
+        logic [Constants::WIDTH-1:0]          prefetch_used;
+        logic [Constants::WIDTH-1:0]          prefetch_discarded;
+        logic [Constants::WIDTH-1:0]          data_loads;
+        logic [Constants::WIDTH-1:0]          data_prefetch_issued;
+        logic [Constants::WIDTH-1:0]          data_prefetch_useful;
+        logic                                 instruction_request_valid;
+        logic [Constants::WIDTH-1:0]          instruction_request_address;
+
+        always_comb begin
+            ce = !store_request[i] || grant[i];
+        end
+
+        mips_r2000 #(
+            .CORE_ID    (i         ),
+            .DMA_ENGINE (DMA_ENGINE)
+        ) mips_r2000_inst (
+            .clk(clk),
+            .nrst(nrst),
+            .ce(ce),
+            .rom(rom),
+            .stall(1'b0),
+            .console_tx_ready(console_tx_ready[i]),
+            .interrupts(6'b00_0000),
+
+            .snoop_store(bus_store && !grant[i]),
+            .snoop_load_store_data_size_mode(bus_load_store_data_size_mode),
+            .snoop_address(bus_address),
+            .snoop_write_data(bus_write_data),
+
+            .instruction_request_ready(1'b0),
+            .instruction_response_valid(1'b0),
+            .instruction_response_data(32'h0000_0000),
+            .data_request_ready(1'b0),
+            .data_response_valid(1'b0),
+            .data_response_data(32'h0000_0000),
+
+            .valid_wb(valid_wb),
+            .pc_wb(pc_wb[i]),
+            .ram(ram_replica),
+            .rd_wb(rd_wb),
+            .rd_address_wb(rd_address_wb),
+            .rd_data_wb(rd_data_wb),
+            .reg_file(reg_file),
+            .idle(idle[i]),
+            .tohost(tohost[i]),
+            .tohost_data(tohost_data[i]),
+            .console_tx(console_tx[i]),
+            .console_tx_data(console_tx_data[i]),
+            .cycle_count(cycle_count[i]),
+            .instret(instret[i]),
+            .bubbles(bubbles),
+            .rom_reads(rom_reads),
+            .prefetch_issued(prefetch_issued),
+            .prefetch_used(prefetch_used),
+            .prefetch_discarded(prefetch_discarded),
+            .data_loads(data_loads),
+            .data_prefetch_issued(data_prefetch_issued),
+            .data_prefetch_useful(data_prefetch_useful),
+            .instruction_request_valid(instruction_request_valid),
+            .instruction_request_address(instruction_request_address),
+            .data_request(data_request[i]),
+            .data_store(data_store[i]),
+            .data_load_store_data_size_mode(data_load_store_data_size_mode[i]),
+            .data_address(data_address[i]),
+            .data_write_data(data_write_data[i])
+        );
+    end
+
+    always_comb begin
+        ram = cores[0].ram_replica;
+    end
+endmodule
\ No newline at end of file
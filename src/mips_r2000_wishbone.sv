@@ -0,0 +1,280 @@
+// Turns a request/response port of the core into a Wishbone B4 classic
+// master. There is one cycle in flight at a time, it starts the cycle after
+// the request and ends on ack or err, stores included, so a store has reached
+// the slave by the time the core moves on. Addresses are word aligned with
+// sel marking the bytes, lane i of the data bus carries the byte at adr + i
+// like on the AXI masters. err ends the cycle like ack and sets error until
+// reset, the read data is still handed to the core.
+module wishbone_master (
+    input var logic clk ,
+    input var logic nrst,
+
+    input  var logic                        request_valid                    ,
+    input  var logic                        request_store                    ,
+    input  var logic [2-1:0]                request_load_store_data_size_mode,
+    input  var logic [Constants::WIDTH-1:0] request_address                  ,
+    input  var logic [Constants::WIDTH-1:0] request_write_data               ,
+    output var logic                        request_ready                    ,
+    output var logic                        response_valid                   ,
+    output var logic [Constants::WIDTH-1:0] response_data                    ,
+    output var logic                        error                            ,
+
+    output var logic                        cyc  ,
+    output var logic                        stb  ,
+    output var logic                        we   ,
+    output var logic [Constants::WIDTH-1:0] adr  ,
+    output var logic [4-1:0]                sel  ,
+    output var logic [Constants::WIDTH-1:0] dat_w,
+    input  var logic [Constants::WIDTH-1:0] dat_r,
+    input  var logic                        ack  ,
+    input  var logic                        err
+);
+    logic [2-1:0] read_lane;
+
+    // Same byte lanes as axi_data_master, a byte access uses the byte at
+    // address + 3 and a half word the two from address + 2 on.
+    logic [Constants::WIDTH-1:0] address      ;
+    logic [4-1:0]                strobe       ;
+    logic [2-1:0]                last_lane    ;
+    logic [Constants::WIDTH-1:0] shifted_write;
+    logic [Constants::WIDTH-1:0] read_word    ;
+    always_comb begin
+        last_lane = request_address[1:0] + 2'd3;
+        address   = request_address;
+        strobe    = 4'b1111;
+        if (request_load_store_data_size_mode == Decode::LoadStoreDataSizeMode_BYTE) begin
+            address = request_address + 3;
+            strobe  = 4'b0001 << address[1:0];
+        end else if (request_load_store_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) begin
+            address = request_address + 2;
+            strobe  = 4'b0011 << address[1:0];
+        end
+
+        shifted_write = request_write_data << {2'd3 - last_lane, 3'b000};
+        read_word     = { dat_r[7:0], dat_r[15:8], dat_r[23:16], dat_r[31:24] } >> {2'd3 - read_lane, 3'b000};
+
+        request_ready = !cyc;
+    end
+
+    always_ff @ (posedge clk, negedge nrst) begin
+        if (!nrst) begin
+            read_lane      <= 0;
+            response_valid <= 0;
+            response_data  <= 0;
+            cyc            <= 0;
+            stb            <= 0;
+            we             <= 0;
+            adr            <= 0;
+            sel            <= 0;
+            dat_w          <= 0;
+            error          <= 0;
+        end else begin
+            response_valid <= 0;
+            if (cyc && (ack || err)) begin
+                cyc            <= 0;
+                stb            <= 0;
+                response_valid <= 1;
+                response_data  <= we ? 0 : read_word;
+                if (err) begin
+                    error <= 1;
+                end
+            end else if (request_valid && request_ready) begin
+                cyc       <= 1;
+                stb       <= 1;
+                we        <= request_store;
+                adr       <= { address[Constants::WIDTH-1:2], 2'b00 };
+                sel       <= strobe;
+                dat_w     <= { shifted_write[7:0], shifted_write[15:8], shifted_write[23:16], shifted_write[31:24] };
+                read_lane <= last_lane;
+            end
+        end
+    end
+endmodule
+
+// The core with its instruction and data ports on Wishbone B4 classic
+// masters. Stores are not posted, so unlike on AXI tohost needs no wait for
+// outstanding writes. bus_error stays set once either master saw err.
+module mips_r2000_wishbone #(
+    parameter int unsigned CORE_ID = 0
+) (
+    input  var logic clk             ,
+    input  var logic nrst            ,
+    input  var logic console_tx_ready,
+
+    output var logic                        instruction_cyc  ,
+    output var logic                        instruction_stb  ,
+    output var logic                        instruction_we   ,
+    output var logic [Constants::WIDTH-1:0] instruction_adr  ,
+    output var logic [4-1:0]                instruction_sel  ,
+    output var logic [Constants::WIDTH-1:0] instruction_dat_w,
+    input  var logic [Constants::WIDTH-1:0] instruction_dat_r,
+    input  var logic                        instruction_ack  ,
+    input  var logic                        instruction_err  ,
+
+    output var logic                        data_cyc  ,
+    output var logic                        data_stb  ,
+    output var logic                        data_we   ,
+    output var logic [Constants::WIDTH-1:0] data_adr  ,
+    output var logic [4-1:0]                data_sel  ,
+    output var logic [Constants::WIDTH-1:0] data_dat_w,
+    input  var logic [Constants::WIDTH-1:0] data_dat_r,
+    input  var logic                        data_ack  ,
+    input  var logic                        data_err  ,
+
+    output var logic                        valid_wb       ,
+    output var logic [Constants::WIDTH-1:0] pc_wb          ,
+    output var logic                        idle           ,
+    output var logic                        tohost         ,
+    output var logic [Constants::WIDTH-1:0] tohost_data    ,
+    output var logic                        console_tx     ,
+    output var logic [Constants::BYTE-1:0]  console_tx_data,
+    output var logic [Constants::WIDTH-1:0] cycle_count    ,
+    output var logic [Constants::WIDTH-1:0] instret        ,
+    output var logic                        bus_error
+);
+    logic [Constants::BYTE-1:0] rom [0:Constants::ROM_SIZE-1];
+    always_comb begin
+        for (int unsigned i = 0; i < Constants::ROM_SIZE; i++) begin
+            rom[i] = 0;
+        end
+    end
+
+    logic                        instruction_request_ready ;
+    logic                        instruction_response_valid;
+    logic [Constants::WIDTH-1:0] instruction_response_data ;
+    logic                        data_request_ready        ;
+    logic                        data_response_valid       ;
+    logic [Constants::WIDTH-1:0] data_response_data        ;
+
+    logic [Constants::BYTE-1:0]           ram [0:Constants::RAM_SIZE-1];
+    logic                                 rd_wb;
+    logic [Constants::REG_ADDR_WIDTH-1:0] rd_address_wb;
+    logic [Constants::WIDTH-1:0]          rd_data_wb;
+    logic [Constants::WIDTH-1:0]          reg_file [0:Constants::REG_COUNT-1-1];
+    logic [Constants::WIDTH-1:0]          bubbles;
+    logic [Constants::WIDTH-1:0]          rom_reads;
+    logic [Constants::WIDTH-1:0]          prefetch_issued;
+    logic [Constants::WIDTH-1:0]          prefetch_used;
+    logic [Constants::WIDTH-1:0]          prefetch_discarded;
+    logic [Constants::WIDTH-1:0]          data_loads;
+    logic [Constants::WIDTH-1:0]          data_prefetch_issued;
+    logic [Constants::WIDTH-1:0]          data_prefetch_useful;
+    logic                                 instruction_request_valid;
+    logic [Constants::WIDTH-1:0]          instruction_request_address;
+    logic                                 data_request;
+    logic                                 data_store;
+    logic [2-1:0]                         data_load_store_data_size_mode;
+    logic [Constants::WIDTH-1:0]          data_address;
+    logic [Constants::WIDTH-1:0]          data_write_data;
+
+    mips_r2000 #(
+        .CORE_ID(CORE_ID),
+        .EXTERNAL_MEMORY(1)
+    ) mips_r2000_inst (
+        .clk(clk),
+        .nrst(nrst),
+        .ce(1'b1),
+        .rom(rom),
+        .stall(1'b0),
+        .console_tx_ready(console_tx_ready),
+        .interrupts(6'b00_0000),
+
+        .snoop_store(1'b0),
+        .snoop_load_store_data_size_mode(2'b00),
+        .snoop_address(32'h0000_0000),
+        .snoop_write_data(32'h0000_0000),
+
+        .instruction_request_ready(instruction_request_ready),
+        .instruction_response_valid(instruction_response_valid),
+        .instruction_response_data(instruction_response_data),
+        .data_request_ready(data_request_ready),
+        .data_response_valid(data_response_valid),
+        .data_response_data(data_response_data),
+
+        .valid_wb(valid_wb),
+        .pc_wb(pc_wb),
+        .ram(ram),
+        .rd_wb(rd_wb),
+        .rd_address_wb(rd_address_wb),
+        .rd_data_wb(rd_data_wb),
+        .reg_file(reg_file),
+        .idle(idle),
+        .tohost(tohost),
+        .tohost_data(tohost_data),
+        .console_tx(console_tx),
+        .console_tx_data(console_tx_data),
+        .cycle_count(cycle_count),
+        .instret(instret),
+        .bubbles(bubbles),
+        .rom_reads(rom_reads),
+        .prefetch_issued(prefetch_issued),
+        .prefetch_used(prefetch_used),
+        .prefetch_discarded(prefetch_discarded),
+        .data_loads(data_loads),
+        .data_prefetch_issued(data_prefetch_issued),
+        .data_prefetch_useful(data_prefetch_useful),
+        .instruction_request_valid(instruction_request_valid),
+        .instruction_request_address(instruction_request_address),
+        .data_request(data_request),
+        .data_store(data_store),
+        .data_load_store_data_size_mode(data_load_store_data_size_mode),
+        .data_address(data_address),
+        .data_write_data(data_write_data)
+    );
+
+    logic instruction_error;
+    wishbone_master wishbone_instruction_master_inst (
+        .clk  (clk ),
+        .nrst (nrst),
+        .
+        request_valid                      (instruction_request_valid        ),
+        .request_store                     (1'b0                             ),
+        .request_load_store_data_size_mode (Decode::LoadStoreDataSizeMode_WORD),
+        .request_address                   (instruction_request_address      ),
+        .request_write_data                (32'h0000_0000                    ),
+        .request_ready                     (instruction_request_ready        ),
+        .response_valid                    (instruction_response_valid       ),
+        .response_data                     (instruction_response_data        ),
+        .error                             (instruction_error                ),
+        .
+        cyc    (instruction_cyc  ),
+        .stb   (instruction_stb  ),
+        .we    (instruction_we   ),
+        .adr   (instruction_adr  ),
+        .sel   (instruction_sel  ),
+        .dat_w (instruction_dat_w),
+        .dat_r (instruction_dat_r),
+        .ack   (instruction_ack  ),
+        .err   (instruction_err  )
+    );
+
+    logic data_error;
+    wishbone_master wishbone_data_master_inst (
+        .clk  (clk ),
+        .nrst (nrst),
+        .
+        request_valid                      (data_request                  ),
+        .request_store                     (data_store                    ),
+        .request_load_store_data_size_mode (data_load_store_data_size_mode),
+        .request_address                   (data_address                  ),
+        .request_write_data                (data_write_data               ),
+        .request_ready                     (data_request_ready            ),
+        .response_valid                    (data_response_valid           ),
+        .response_data                     (data_response_data            ),
+        .error                             (data_error                    ),
+        .
+        cyc    (data_cyc  ),
+        .stb   (data_stb  ),
+        .we    (data_we   ),
+        .adr   (data_adr  ),
+        .sel   (data_sel  ),
+        .dat_w (data_dat_w),
+        .dat_r (data_dat_r),
+        .ack   (data_ack  ),
+        .err   (data_err  )
+    );
+
+    always_comb begin
+        bus_error = instruction_error || data_error;
+    end
+endmodule
\ No newline at end of file
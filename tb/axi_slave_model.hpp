@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Cycle based model of an AXI4 slave in front of a memory. Up to
+// max_outstanding read and write bursts are accepted, each one answers after
+// a latency drawn from [min_latency, max_latency] and then streams one beat
+// per cycle, responses come back in order. Lane i of the data bus carries the
+// byte at the aligned address + i. Addresses wrap at the size, which has to be
+// a power of two. With slverr every read beat and write response carries
+// SLVERR, the data is still transferred.
+struct AxiSlaveModel {
+    struct Config {
+        uint32_t min_latency { 1 };
+        uint32_t max_latency { 1 };
+        uint32_t max_outstanding { 4 };
+        uint32_t seed { 0 };
+        bool slverr { false };
+    };
+
+    struct Response {
+        bool arready { false };
+        bool rvalid { false };
+        uint32_t rdata { 0 };
+        uint32_t rresp { 0 };
+        bool rlast { false };
+        bool awready { false };
+        bool wready { false };
+        bool bvalid { false };
+        uint32_t bresp { 0 };
+    };
+
+    struct Request {
+        bool arvalid { false };
+        uint32_t araddr { 0 };
+        uint32_t arlen { 0 };
+        uint32_t arsize { 2 };
+        bool rready { true };
+        bool awvalid { false };
+        uint32_t awaddr { 0 };
+        uint32_t awlen { 0 };
+        uint32_t awsize { 2 };
+        bool wvalid { false };
+        uint32_t wdata { 0 };
+        uint32_t wstrb { 0 };
+        bool wlast { false };
+        bool bready { true };
+    };
+
+    struct Burst {
+        uint64_t due;
+        uint32_t address;
+        uint32_t beats;
+        uint32_t size;
+    };
+
+    std::vector<uint8_t> bytes;
+    Config config;
+    std::mt19937 rng;
+    std::deque<Burst> reads {};
+    std::deque<Burst> writes {};
+    std::deque<uint64_t> write_responses {};
+    uint64_t cycle { 0 };
+    uint64_t read_bursts { 0 };
+    uint64_t read_beats { 0 };
+    uint64_t write_bursts { 0 };
+    uint64_t max_reads_in_flight { 0 };
+    uint64_t max_writes_in_flight { 0 };
+
+    AxiSlaveModel(const std::size_t size, const Config& config):
+        bytes(size, 0),
+        config { config },
+        rng { config.seed }
+    {}
+
+    void load(const std::vector<uint8_t>& image) {
+        std::fill(bytes.begin(), bytes.end(), 0);
+        std::copy_n(image.begin(), std::min(image.size(), bytes.size()), bytes.begin());
+    }
+
+    uint8_t& at(const uint32_t address) {
+        return bytes[address & (bytes.size() - 1)];
+    }
+
+    // Big endian word at an aligned address, the way the core sees memory.
+    uint32_t word(const uint32_t address) {
+        return (
+            (static_cast<uint32_t>(at(address + 0)) << 24)
+            | (static_cast<uint32_t>(at(address + 1)) << 16)
+            | (static_cast<uint32_t>(at(address + 2)) << 8)
+            | static_cast<uint32_t>(at(address + 3))
+        );
+    }
+
+    // What the slave shows during the current cycle, it only depends on the
+    // state left by earlier cycles.
+    Response drive() {
+        Response ret {};
+        ret.arready = (reads.size() < config.max_outstanding);
+        ret.awready = (writes.size() + write_responses.size() < config.max_outstanding);
+        ret.wready = !writes.empty();
+        if(!reads.empty() && (reads.front().due <= cycle)) {
+            const uint32_t aligned { reads.front().address & ~uint32_t { 3 } };
+            ret.rvalid = true;
+            ret.rdata = (
+                static_cast<uint32_t>(at(aligned + 0))
+                | (static_cast<uint32_t>(at(aligned + 1)) << 8)
+                | (static_cast<uint32_t>(at(aligned + 2)) << 16)
+                | (static_cast<uint32_t>(at(aligned + 3)) << 24)
+            );
+            ret.rlast = (reads.front().beats == 1);
+            ret.rresp = config.slverr ? 0b10 : 0b00;
+        }
+        if(!write_responses.empty() && (write_responses.front() <= cycle)) {
+            ret.bvalid = true;
+            ret.bresp = config.slverr ? 0b10 : 0b00;
+        }
+        return ret;
+    }
+
+    // Takes what the master presents during the current cycle and advances to
+    // the next one.
+    void commit(const Response& response, const Request& request) {
+        if(response.rvalid && request.rready) {
+            read_beats++;
+            Burst& burst { reads.front() };
+            burst.address = (burst.address & ~((uint32_t { 1 } << burst.size) - 1)) + (uint32_t { 1 } << burst.size);
+            if(--burst.beats == 0) {
+                reads.pop_front();
+            }
+        }
+        if(response.wready && request.wvalid) {
+            Burst& burst { writes.front() };
+            const uint32_t aligned { burst.address & ~uint32_t { 3 } };
+            for(uint32_t i = 0; i < 4; i++) {
+                if(request.wstrb & (1 << i)) {
+                    at(aligned + i) = request.wdata >> (i * 8);
+                }
+            }
+            burst.address = (burst.address & ~((uint32_t { 1 } << burst.size) - 1)) + (uint32_t { 1 } << burst.size);
+            if(--burst.beats == 0) {
+                write_responses.push_back(cycle + latency());
+                writes.pop_front();
+            }
+        }
+        if(response.bvalid && request.bready) {
+            write_responses.pop_front();
+        }
+        if(request.arvalid && response.arready) {
+            const uint64_t due { std::max<uint64_t>(cycle + latency(), reads.empty() ? 0 : reads.back().due) };
+            reads.push_back({ due, request.araddr, request.arlen + 1, request.arsize });
+            read_bursts++;
+        }
+        if(request.awvalid && response.awready) {
+            writes.push_back({ 0, request.awaddr, request.awlen + 1, request.awsize });
+            write_bursts++;
+        }
+        max_reads_in_flight = std::max<uint64_t>(max_reads_in_flight, reads.size());
+        max_writes_in_flight = std::max<uint64_t>(max_writes_in_flight, writes.size() + write_responses.size());
+        cycle++;
+    }
+
+private:
+    uint32_t latency() {
+        return std::max<uint32_t>(std::uniform_int_distribution<uint32_t> { config.min_latency, config.max_latency }(rng), 1);
+    }
+};
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include <print>
 #include <string_view>
 #include <bitset>
+#include <bit>
+#include <optional>
 #include <verilated.h>
 #include <verilated_fst_sc.h>
 #include "Vbubble_sort_demo.h"
@@ -53,6 +55,55 @@ struct Predictor {
             };
         });
     }
+
+    static void scan(const std::unique_ptr<Vbubble_sort_demo>& dut, const std::array<sc_bv<4>, 8>& numbers) {
+        const auto predictors = std::ranges::to<std::vector>(generate(numbers));
+        std::bitset<8> shown {};
+        for(const auto i: std::views::iota(0U, 2U * predictors.size())) {
+            const auto index = std::countr_one(static_cast<uint8_t>(dut->an.read().to_uint()));
+            predictors[index] == dut;
+            shown[index] = true;
+            sc_start(10, SC_NS);
+        }
+        assert(shown.all());
+    }
+};
+
+// Must match -GUART_CLOCKS_PER_BIT in CMakeLists.txt
+constexpr unsigned UART_CLOCKS_PER_BIT = 4;
+
+struct UartReceiver {
+    unsigned count { 0 };
+    bool busy { false };
+    uint8_t data { 0 };
+
+    std::optional<char> sample(const bool line) {
+        if(busy == false) {
+            if(line == false) {
+                busy = true;
+                count = 0;
+                data = 0;
+            }
+            return std::nullopt;
+        }
+
+        count++;
+        if(count % UART_CLOCKS_PER_BIT != UART_CLOCKS_PER_BIT / 2) {
+            return std::nullopt;
+        }
+
+        const auto index = count / UART_CLOCKS_PER_BIT;
+        if(index == 0) {
+            assert(line == false);
+        } else if(index <= 8) {
+            data |= static_cast<uint8_t>(line) << (index - 1);
+        } else {
+            assert(line == true);
+            busy = false;
+            return static_cast<char>(data);
+        }
+        return std::nullopt;
+    }
 };
 
 std::ostream& operator<<(std::ostream& os, const Predictor& obj) {
@@ -156,17 +207,23 @@ int sc_main(int argc, char* argv[]) {
     sc_signal<bool> nrst;
     sc_signal<bool> stall;
     sc_signal<bool> turbo;
+    sc_signal<bool> benchmark;
     sc_signal<bool> step;
     sc_signal<bool> show_pc_wb;
     sc_signal<bool> show_stack_array;
     sc_signal<bool> show_ra;
     sc_signal<bool> show_s8;
     sc_signal<bool> show_sp;
+    sc_signal<bool> show_cycle_count;
+    sc_signal<bool> show_instret;
 
     // outputs
     sc_signal<sc_bv<8>> an;
     sc_signal<sc_bv<7>> seg;
     sc_signal<bool> dp;
+    sc_signal<bool> idle;
+    sc_signal<bool> tohost;
+    sc_signal<bool> uart_rxd_out;
 
     const std::unique_ptr<Vbubble_sort_demo> dut{new Vbubble_sort_demo{"bubble_sort_demo_context"}};
 
@@ -175,27 +232,36 @@ int sc_main(int argc, char* argv[]) {
     dut->nrst(nrst);
     dut->stall(stall);
     dut->turbo(turbo);
+    dut->benchmark(benchmark);
     dut->step(step);
     dut->show_pc_wb(show_pc_wb);
     dut->show_stack_array(show_stack_array);
     dut->show_ra(show_ra);
     dut->show_s8(show_s8);
     dut->show_sp(show_sp);
+    dut->show_cycle_count(show_cycle_count);
+    dut->show_instret(show_instret);
 
     // outputs
     dut->an(an);
     dut->seg(seg);
     dut->dp(dp);
+    dut->idle(idle);
+    dut->tohost(tohost);
+    dut->uart_rxd_out(uart_rxd_out);
 
     nrst = 1;
     stall = 0;
     turbo = 1;
+    benchmark = 0;
     step = 0;
     show_pc_wb = 0;
     show_stack_array = 0;
     show_ra = 0;
     show_s8 = 0;
     show_sp = 0;
+    show_cycle_count = 0;
+    show_instret = 0;
 
     sc_start(SC_ZERO_TIME);
     Verilated::mkdir("logs");
@@ -205,38 +271,37 @@ int sc_main(int argc, char* argv[]) {
     std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
     reset(nrst);
 
-    for(const auto [i, predictor]: std::views::enumerate(Predictor::generate({
+    Predictor::scan(dut, {
         0xA, 0xB, 0xB, 0xA,
         0xB, 0xA, 0xB, 0xA,
-    }))) {
-        if(i == 0) {
-            predictor == dut;
-            sc_start(50, SC_US);
-        } else {
-            sc_start(50, SC_US);
-            predictor == dut;
-            sc_start(50, SC_US);
-        }
-    }
+    });
 
     show_pc_wb = 1;
-    sc_start(250, SC_US);
-
-    sc_start(1, SC_MS);
-    sc_start(1, SC_MS);
-
-    sc_start(1, SC_MS);
-    sc_start(1, SC_MS);
-
-    sc_start(1, SC_MS);
-    sc_start(1, SC_MS);
+    Console console {};
+    UartReceiver uart {};
+    while(dut->tohost.read() == false || uart.busy) {
+        if(const auto c = uart.sample(dut->uart_rxd_out.read())) {
+            console << *c;
+        }
+        sc_start(10, SC_NS);
+    }
+    console.flush();
+    // the letters come from .data and the swap count from .bss, both only
+    // right if the ram initializer filled and cleared them
+    assert(console.output == "251F73A0\n012357AF\nE\n");
 
-    // pc_wb == 0
-    sc_start(1, SC_MS);
-    sc_start(1, SC_MS);
+    // start.s stores the exit code to tohost at 0x10
+    Predictor::scan(dut, {
+        0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x1, 0x0,
+    });
 
-    sc_start(28, SC_MS);
-    sc_start(1, SC_MS);
+    show_pc_wb = 0;
+    show_stack_array = 1;
+    Predictor::scan(dut, {
+        0x0, 0x1, 0x2, 0x3,
+        0x5, 0x7, 0xA, 0xF,
+    });
 
     if(tfp) { tfp->flush(); tfp->close(); }
     dut->final();
@@ -42,34 +42,40 @@ struct Predictor {
     bool load_sign_extend_id { false };
     sc_bv<2> load_store_data_size_mode_id { 0 };
     bool store_id { false };
+    bool load_linked_id { false };
+    bool store_conditional_id { false };
 
     void operator==(const std::unique_ptr<Vdecode>& dut) const {
+        const Decode::Control control { dut->control_id.read() };
         assert(pc_id == dut->pc_id.read());
-        assert(rs_id == dut->rs_id.read());
-        assert(rs_address_id == dut->rs_address_id.read());
+        assert(rs_id == control.rs);
+        assert(rs_address_id == control.rs_address);
         assert(rs_data_id == dut->rs_data_id.read());
-        assert(rt_id == dut->rt_id.read());
-        assert(rt_address_id == dut->rt_address_id.read());
+        assert(rt_id == control.rt);
+        assert(rt_address_id == control.rt_address);
         assert(rt_data_id == dut->rt_data_id.read());
-        assert(rd_id == dut->rd_id.read());
-        assert(rd_address_id == dut->rd_address_id.read());
-        assert(shamt_id == dut->shamt_id.read());
-        assert(shamt_value_id == dut->shamt_value_id.read());
-        assert(imm_id == dut->imm_id.read());
-        assert(imm_value_id == dut->imm_value_id.read());
-        assert(target_id == dut->target_id.read());
-        assert(target_value_id == dut->target_value_id.read());
-        assert(alu_mode_id == dut->alu_mode_id.read());
-        assert(alu_mode_value_id == dut->alu_mode_value_id.read());
-        assert(link_id == dut->link_id.read());
-        assert(branch_id == dut->branch_id.read());
-        assert(branch_mode_id == dut->branch_mode_id.read());
-        assert(jump_id == dut->jump_id.read());
-        assert(lui_id == dut->lui_id.read());
-        assert(load_id == dut->load_id.read());
-        assert(load_sign_extend_id == dut->load_sign_extend_id.read());
-        assert(load_store_data_size_mode_id == dut->load_store_data_size_mode_id.read());
-        assert(store_id == dut->store_id.read());
+        assert(rd_id == control.rd);
+        assert(rd_address_id == control.rd_address);
+        assert(shamt_id == control.shamt);
+        assert(shamt_value_id == control.shamt_value);
+        assert(imm_id == control.imm);
+        assert(imm_value_id == control.imm_value);
+        assert(target_id == control.target);
+        assert(target_value_id == control.target_value);
+        assert(alu_mode_id == control.alu_mode);
+        assert(link_id == control.link);
+        assert(branch_id == control.branch);
+        assert(jump_id == control.jump);
+        assert(load_id == control.load);
+        assert(load_sign_extend_id == control.load_sign_extend);
+        assert(load_store_data_size_mode_id == control.load_store_data_size_mode);
+        assert(store_id == control.store);
+        assert(load_linked_id == control.load_linked);
+        assert(store_conditional_id == control.store_conditional);
+        // The encoded modes only reach EX as selects.
+        assert(Decode::alu_select(alu_mode_id, alu_mode_value_id.to_uint(), link_id, lui_id, load_id, store_id) == control.alu_select);
+        assert(Decode::branch_select(branch_id, branch_mode_id.to_uint()) == control.branch_select);
+        assert(Decode::trap(alu_mode_id, alu_mode_value_id.to_uint(), link_id) == control.trap);
     }
 };
 
@@ -1364,6 +1370,8 @@ int sc_main(int argc, char* argv[]) {
     // inputs
     sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
     sc_signal<bool> nrst;
+    sc_signal<bool> ce;
+    sc_signal<bool> ce_if;
     const uint8_t ROM[] {
         // asm("add $1,  $0,  $1"); type instructions for writeback check
         0x00,0x01,0x08,0x20,
@@ -1448,91 +1456,102 @@ int sc_main(int argc, char* argv[]) {
     static_assert((sizeof(ROM) > 4) && ((sizeof(ROM) % 4) == 0));
     std::vector<sc_signal<sc_bv<8>>> rom(std::extent_v<std::remove_reference_t<decltype(Vdecode::rom)>>);
     sc_signal<bool> stall;
+    sc_signal<bool> instruction_request_ready_if;
+    sc_signal<bool> instruction_response_valid_if;
+    sc_signal<sc_bv<32>> instruction_response_data_if;
     sc_signal<bool> branch_taken_ex;
     sc_signal<sc_bv<32>> branch_target_ex;
+    sc_signal<sc_bv<2>> branch_thread_ex;
+    sc_signal<sc_bv<32>> branch_pc_ex;
+    sc_signal<bool> flush_if;
+    sc_signal<sc_bv<2>> thread_wb;
     sc_signal<bool> rd_wb;
     sc_signal<sc_bv<5>> rd_address_wb;
     sc_signal<sc_bv<32>> rd_data_wb;
+    sc_signal<bool> lane1_rd_wb;
+    sc_signal<sc_bv<5>> lane1_rd_address_wb;
+    sc_signal<sc_bv<32>> lane1_rd_data_wb;
 
     // outputs
-    sc_signal<bool> rs_id;
-    sc_signal<bool> rt_id;
-    sc_signal<bool> rd_id;
-    sc_signal<bool> shamt_id;
-    sc_signal<bool> imm_id;
-    sc_signal<bool> target_id;
-    sc_signal<bool> alu_mode_id;
-    sc_signal<bool> link_id;
-    sc_signal<bool> branch_id;
-    sc_signal<bool> jump_id;
-    sc_signal<bool> lui_id;
-    sc_signal<bool> load_id;
-    sc_signal<bool> load_sign_extend_id;
-    sc_signal<bool> store_id;
+    sc_signal<bool> valid_if;
+    sc_signal<bool> squash_if;
+    sc_signal<bool> valid_id;
+    sc_signal<sc_bv<2>> thread_id;
     sc_signal<sc_bv<32>> pc_id;
-    sc_signal<sc_bv<5>> rs_address_id;
+    sc_signal<sc_bv<Decode::Control::WIDTH>> control_id;
     sc_signal<sc_bv<32>> rs_data_id;
-    sc_signal<sc_bv<5>> rt_address_id;
     sc_signal<sc_bv<32>> rt_data_id;
-    sc_signal<sc_bv<5>> rd_address_id;
-    sc_signal<sc_bv<5>> shamt_value_id;
-    sc_signal<sc_bv<16>> imm_value_id;
-    sc_signal<sc_bv<26>> target_value_id;
-    sc_signal<sc_bv<5>> alu_mode_value_id;
-    sc_signal<sc_bv<3>> branch_mode_id;
-    sc_signal<sc_bv<2>> load_store_data_size_mode_id;
     std::vector<sc_signal<sc_bv<32>>> reg_file(std::extent_v<std::remove_reference_t<decltype(Vdecode::reg_file)>>);
+    sc_signal<bool> lane1_valid_id;
+    sc_signal<sc_bv<32>> lane1_pc_id;
+    sc_signal<sc_bv<Decode::Control::WIDTH>> lane1_control_id;
+    sc_signal<sc_bv<32>> lane1_rs_data_id;
+    sc_signal<sc_bv<32>> lane1_rt_data_id;
+    sc_signal<bool> rom_read_if;
+    sc_signal<sc_bv<32>> prefetch_issued_if;
+    sc_signal<sc_bv<32>> prefetch_used_if;
+    sc_signal<sc_bv<32>> prefetch_discarded_if;
+    sc_signal<bool> instruction_request_valid_if;
+    sc_signal<sc_bv<32>> instruction_request_address_if;
 
     const std::unique_ptr<Vdecode> dut{new Vdecode{"decode_context"}};
 
     // inputs
     dut->clk(clk);
     dut->nrst(nrst);
+    dut->ce(ce);
+    dut->ce_if(ce_if);
     for(const auto& [port, sig]: std::views::zip(dut->rom, rom)) {
         port(sig);
     }
     dut->stall(stall);
+    dut->instruction_request_ready_if(instruction_request_ready_if);
+    dut->instruction_response_valid_if(instruction_response_valid_if);
+    dut->instruction_response_data_if(instruction_response_data_if);
     dut->branch_taken_ex(branch_taken_ex);
     dut->branch_target_ex(branch_target_ex);
+    dut->branch_thread_ex(branch_thread_ex);
+    dut->branch_pc_ex(branch_pc_ex);
+    dut->flush_if(flush_if);
+    dut->thread_wb(thread_wb);
     dut->rd_wb(rd_wb);
     dut->rd_address_wb(rd_address_wb);
     dut->rd_data_wb(rd_data_wb);
+    dut->lane1_rd_wb(lane1_rd_wb);
+    dut->lane1_rd_address_wb(lane1_rd_address_wb);
+    dut->lane1_rd_data_wb(lane1_rd_data_wb);
 
     // outputs
-    dut->rs_id(rs_id);
-    dut->rt_id(rt_id);
-    dut->rd_id(rd_id);
-    dut->shamt_id(shamt_id);
-    dut->imm_id(imm_id);
-    dut->target_id(target_id);
-    dut->alu_mode_id(alu_mode_id);
-    dut->link_id(link_id);
-    dut->branch_id(branch_id);
-    dut->jump_id(jump_id);
-    dut->lui_id(lui_id);
-    dut->load_id(load_id);
-    dut->load_sign_extend_id(load_sign_extend_id);
-    dut->store_id(store_id);
+    dut->valid_if(valid_if);
+    dut->squash_if(squash_if);
+    dut->valid_id(valid_id);
+    dut->thread_id(thread_id);
     dut->pc_id(pc_id);
-    dut->rs_address_id(rs_address_id);
+    dut->control_id(control_id);
     dut->rs_data_id(rs_data_id);
-    dut->rt_address_id(rt_address_id);
     dut->rt_data_id(rt_data_id);
-    dut->rd_address_id(rd_address_id);
-    dut->shamt_value_id(shamt_value_id);
-    dut->imm_value_id(imm_value_id);
-    dut->target_value_id(target_value_id);
-    dut->alu_mode_value_id(alu_mode_value_id);
-    dut->branch_mode_id(branch_mode_id);
-    dut->load_store_data_size_mode_id(load_store_data_size_mode_id);
     for(const auto& [port, sig]: std::views::zip(dut->reg_file, reg_file)) {
         port(sig);
     }
+    dut->lane1_valid_id(lane1_valid_id);
+    dut->lane1_pc_id(lane1_pc_id);
+    dut->lane1_control_id(lane1_control_id);
+    dut->lane1_rs_data_id(lane1_rs_data_id);
+    dut->lane1_rt_data_id(lane1_rt_data_id);
+    dut->rom_read_if(rom_read_if);
+    dut->prefetch_issued_if(prefetch_issued_if);
+    dut->prefetch_used_if(prefetch_used_if);
+    dut->prefetch_discarded_if(prefetch_discarded_if);
+    dut->instruction_request_valid_if(instruction_request_valid_if);
+    dut->instruction_request_address_if(instruction_request_address_if);
 
     nrst = 1;
+    ce = 1;
+    ce_if = 1;
     stall = 0;
     branch_taken_ex = 0;
     branch_target_ex = 0;
+    flush_if = 0;
     for(const auto& [data, sig]: std::views::zip(ROM, rom)) {
         sig = data;
     }
@@ -1564,15 +1583,16 @@ int sc_main(int argc, char* argv[]) {
         }
 
         sc_start(5, SC_NS);
-        assert(dut->rs_id.read() == 1);
-        assert(dut->rs_address_id.read() == i);
+        const Decode::Control control { dut->control_id.read() };
+        assert(control.rs == 1);
+        assert(control.rs_address == i);
         assert(dut->rs_data_id.read() == 0);
 
-        assert(dut->rd_id.read() == 1);
-        assert(dut->rd_address_id.read() == i + 1);
+        assert(control.rd == 1);
+        assert(control.rd_address == i + 1);
 
-        assert(dut->rt_id.read() == 1);
-        assert(dut->rt_address_id.read() == i + 1);
+        assert(control.rt == 1);
+        assert(control.rt_address == i + 1);
         assert(dut->rt_data_id.read() == 0);
 
         sc_start(5, SC_NS);
@@ -1599,14 +1619,15 @@ int sc_main(int argc, char* argv[]) {
         }
 
         sc_start(5, SC_NS);
-        assert(dut->rs_id.read() == 1);
-        assert(dut->rs_address_id.read() == i);
+        const Decode::Control control { dut->control_id.read() };
+        assert(control.rs == 1);
+        assert(control.rs_address == i);
 
-        assert(dut->rd_id.read() == 1);
-        assert(dut->rd_address_id.read() == i + 1);
+        assert(control.rd == 1);
+        assert(control.rd_address == i + 1);
 
-        assert(dut->rt_id.read() == 1);
-        assert(dut->rt_address_id.read() == i + 1);
+        assert(control.rt == 1);
+        assert(control.rt_address == i + 1);
 
         if(i == 0) {
             assert(dut->rs_data_id.read() == 0);
@@ -22,18 +22,23 @@ struct Predictor {
     bool load_sign_extend_ex { 0 };
     sc_bv<2> load_store_data_size_mode_ex { 0 };
     bool store_ex { 0 };
+    bool load_linked_ex { 0 };
+    bool store_conditional_ex { 0 };
 
     void operator==(const std::unique_ptr<Vexecute>& dut) const {
+        const Decode::Control control { dut->control_ex.read() };
         assert(pc_ex == dut->pc_ex.read());
-        assert(rd_ex == dut->rd_ex.read());
-        assert(rd_address_ex == dut->rd_address_ex.read());
-        assert(alu_mode_ex == dut->alu_mode_ex.read());
+        assert(rd_ex == control.rd);
+        assert(rd_address_ex == control.rd_address);
+        assert(alu_mode_ex == control.alu_mode);
         assert(alu_result_ex == dut->alu_result_ex.read());
         assert(rt_data_ex == dut->rt_data_ex.read());
-        assert(load_ex == dut->load_ex.read());
-        assert(load_sign_extend_ex == dut->load_sign_extend_ex.read());
-        assert(load_store_data_size_mode_ex == dut->load_store_data_size_mode_ex.read());
-        assert(store_ex == dut->store_ex.read());
+        assert(load_ex == control.load);
+        assert(load_sign_extend_ex == control.load_sign_extend);
+        assert(load_store_data_size_mode_ex == control.load_store_data_size_mode);
+        assert(store_ex == control.store);
+        assert(load_linked_ex == control.load_linked);
+        assert(store_conditional_ex == control.store_conditional);
     }
 };
 
@@ -770,6 +775,9 @@ int sc_main(int argc, char* argv[]) {
     // inputs
     sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
     sc_signal<bool> nrst;
+    sc_signal<bool> ce;
+    sc_signal<bool> ce_id;
+    sc_signal<bool> ce_if;
     const uint8_t ROM[] {
         // nop; sll $0, $0, 0 type instructions for writeback check
         0x00,0x00,0x00,0x00,
@@ -909,56 +917,111 @@ int sc_main(int argc, char* argv[]) {
     static_assert((sizeof(ROM) > 4) && ((sizeof(ROM) % 4) == 0));
     std::vector<sc_signal<sc_bv<8>>> rom(std::extent_v<std::remove_reference_t<decltype(Vexecute::rom)>>);
     sc_signal<bool> stall;
+    sc_signal<bool> flush_if;
+    sc_signal<bool> flush_id;
+    sc_signal<sc_bv<6>> interrupts;
+    sc_signal<bool> instruction_request_ready_if;
+    sc_signal<bool> instruction_response_valid_if;
+    sc_signal<sc_bv<32>> instruction_response_data_if;
+    sc_signal<sc_bv<2>> thread_wb;
     sc_signal<bool> rd_wb;
     sc_signal<sc_bv<5>> rd_address_wb;
     sc_signal<sc_bv<32>> rd_data_wb;
+    sc_signal<bool> lane1_rd_wb;
+    sc_signal<sc_bv<5>> lane1_rd_address_wb;
+    sc_signal<sc_bv<32>> lane1_rd_data_wb;
 
     // outputs
-    sc_signal<bool> rd_ex;
-    sc_signal<bool> alu_mode_ex;
-    sc_signal<bool> load_ex;
-    sc_signal<bool> load_sign_extend_ex;
-    sc_signal<bool> store_ex;
+    sc_signal<bool> idle_ex;
+    sc_signal<bool> accelerator_busy_ex;
+    sc_signal<bool> mac_busy_ex;
+    sc_signal<bool> cop0_exception_ex;
+    sc_signal<bool> cop0_redirect_ex;
+    sc_signal<bool> rom_read_if;
+    sc_signal<sc_bv<32>> prefetch_issued_if;
+    sc_signal<sc_bv<32>> prefetch_used_if;
+    sc_signal<sc_bv<32>> prefetch_discarded_if;
+    sc_signal<bool> instruction_request_valid_if;
+    sc_signal<sc_bv<32>> instruction_request_address_if;
 
+    sc_signal<bool> valid_if;
+    sc_signal<bool> squash_if;
+    sc_signal<bool> valid_ex;
+    sc_signal<sc_bv<2>> thread_ex;
     sc_signal<sc_bv<32>> pc_ex;
-    sc_signal<sc_bv<5>> rd_address_ex;
+    sc_signal<sc_bv<Decode::Control::WIDTH>> control_ex;
     sc_signal<sc_bv<32>> alu_result_ex;
     sc_signal<sc_bv<32>> rt_data_ex;
-    sc_signal<sc_bv<2>> load_store_data_size_mode_ex;
     std::vector<sc_signal<sc_bv<32>>> reg_file(std::extent_v<std::remove_reference_t<decltype(Vexecute::reg_file)>>);
+    sc_signal<bool> lane1_valid_ex;
+    sc_signal<sc_bv<32>> lane1_pc_ex;
+    sc_signal<sc_bv<Decode::Control::WIDTH>> lane1_control_ex;
+    sc_signal<sc_bv<32>> lane1_alu_result_ex;
 
     const std::unique_ptr<Vexecute> dut{new Vexecute{"execute_context"}};
 
     // inputs
     dut->clk(clk);
     dut->nrst(nrst);
+    dut->ce(ce);
+    dut->ce_id(ce_id);
+    dut->ce_if(ce_if);
     for(const auto& [port, sig]: std::views::zip(dut->rom, rom)) {
         port(sig);
     }
     dut->stall(stall);
+    dut->flush_if(flush_if);
+    dut->flush_id(flush_id);
+    dut->instruction_request_ready_if(instruction_request_ready_if);
+    dut->instruction_response_valid_if(instruction_response_valid_if);
+    dut->instruction_response_data_if(instruction_response_data_if);
+    dut->interrupts(interrupts);
+    dut->thread_wb(thread_wb);
     dut->rd_wb(rd_wb);
     dut->rd_address_wb(rd_address_wb);
     dut->rd_data_wb(rd_data_wb);
+    dut->lane1_rd_wb(lane1_rd_wb);
+    dut->lane1_rd_address_wb(lane1_rd_address_wb);
+    dut->lane1_rd_data_wb(lane1_rd_data_wb);
 
     // outputs
-    dut->rd_ex(rd_ex);
-    dut->alu_mode_ex(alu_mode_ex);
-    dut->load_ex(load_ex);
-    dut->load_sign_extend_ex(load_sign_extend_ex);
-    dut->store_ex(store_ex);
+    dut->idle_ex(idle_ex);
+    dut->accelerator_busy_ex(accelerator_busy_ex);
+    dut->mac_busy_ex(mac_busy_ex);
+    dut->cop0_exception_ex(cop0_exception_ex);
+    dut->cop0_redirect_ex(cop0_redirect_ex);
+    dut->rom_read_if(rom_read_if);
+    dut->prefetch_issued_if(prefetch_issued_if);
+    dut->prefetch_used_if(prefetch_used_if);
+    dut->prefetch_discarded_if(prefetch_discarded_if);
+    dut->instruction_request_valid_if(instruction_request_valid_if);
+    dut->instruction_request_address_if(instruction_request_address_if);
 
+    dut->valid_if(valid_if);
+    dut->squash_if(squash_if);
+    dut->valid_ex(valid_ex);
+    dut->thread_ex(thread_ex);
     dut->pc_ex(pc_ex);
-    dut->rd_address_ex(rd_address_ex);
+    dut->control_ex(control_ex);
     dut->alu_result_ex(alu_result_ex);
     dut->rt_data_ex(rt_data_ex);
-    dut->load_store_data_size_mode_ex(load_store_data_size_mode_ex);
     for(const auto& [port, sig]: std::views::zip(dut->reg_file, reg_file)) {
         port(sig);
     }
 
+    dut->lane1_valid_ex(lane1_valid_ex);
+    dut->lane1_pc_ex(lane1_pc_ex);
+    dut->lane1_control_ex(lane1_control_ex);
+    dut->lane1_alu_result_ex(lane1_alu_result_ex);
 
     nrst = 1;
+    ce = 1;
+    ce_id = 1;
+    ce_if = 1;
     stall = 0;
+    flush_if = 0;
+    flush_id = 0;
+    interrupts = 0;
     for(const auto& [data, sig]: std::views::zip(ROM, rom)) {
         sig = data;
     }
@@ -1001,7 +1064,7 @@ int sc_main(int argc, char* argv[]) {
     // register file read with sw rt, imm(rs)
     for(const uint32_t i: std::views::iota(0U, Constants::REG_COUNT)) {
         sc_start(5, SC_NS);
-        assert(dut->store_ex.read() == 1);
+        assert(Decode::Control { dut->control_ex.read() }.store);
         if(i == 0) {
             assert(dut->rt_data_ex.read() == 0);
         } else {
@@ -1021,6 +1084,7 @@ int sc_main(int argc, char* argv[]) {
         i == dut;
         sc_start(5, SC_NS);
     }
+    assert(dut->idle_ex.read());
 
     if(tfp) { tfp->flush(); tfp->close(); }
     dut->final();
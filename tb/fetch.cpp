@@ -26,9 +26,18 @@ int sc_main(int argc, char* argv[]) {
 
     sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
     sc_signal<bool> nrst;
+    sc_signal<bool> ce;
+    sc_signal<bool> ce_core;
     sc_signal<bool> stall;
+    sc_signal<bool> instruction_request_ready_if;
+    sc_signal<bool> instruction_response_valid_if;
+    sc_signal<sc_bv<32>> instruction_response_data_if;
     sc_signal<bool> branch_taken_ex;
     sc_signal<sc_bv<32>> branch_target_ex;
+    sc_signal<sc_bv<2>> branch_thread_ex;
+    sc_signal<sc_bv<32>> branch_pc_ex;
+    sc_signal<bool> flush_if;
+    sc_signal<bool> pair_id;
     const uint8_t ROM[] = {
         0x27,0xbd,0xff,0xf0,
         0xaf,0xbe,0x00,0x0c,
@@ -70,26 +79,58 @@ int sc_main(int argc, char* argv[]) {
     };
     static_assert((sizeof(ROM) > 4) && ((sizeof(ROM) % 4) == 0));
     std::vector<sc_signal<sc_bv<8>>> rom(std::extent_v<std::remove_reference_t<decltype(Vfetch::rom)>>);
+    sc_signal<bool> valid_if;
+    sc_signal<bool> squash_if;
+    sc_signal<sc_bv<2>> thread_if;
     sc_signal<sc_bv<32>> pc_if;
     sc_signal<sc_bv<32>> instruction_if;
+    sc_signal<sc_bv<32>> lane1_instruction_if;
+    sc_signal<bool> rom_read_if;
+    sc_signal<sc_bv<32>> prefetch_issued_if;
+    sc_signal<sc_bv<32>> prefetch_used_if;
+    sc_signal<sc_bv<32>> prefetch_discarded_if;
+    sc_signal<bool> instruction_request_valid_if;
+    sc_signal<sc_bv<32>> instruction_request_address_if;
 
     const std::unique_ptr<Vfetch> dut{new Vfetch{"fetch_context"}};
 
     dut->clk(clk);
     dut->nrst(nrst);
+    dut->ce(ce);
+    dut->ce_core(ce_core);
     dut->stall(stall);
+    dut->instruction_request_ready_if(instruction_request_ready_if);
+    dut->instruction_response_valid_if(instruction_response_valid_if);
+    dut->instruction_response_data_if(instruction_response_data_if);
     dut->branch_taken_ex(branch_taken_ex);
     dut->branch_target_ex(branch_target_ex);
+    dut->branch_thread_ex(branch_thread_ex);
+    dut->branch_pc_ex(branch_pc_ex);
+    dut->flush_if(flush_if);
+    dut->pair_id(pair_id);
     for(const auto& [port, sig]: std::views::zip(dut->rom, rom)) {
         port(sig);
     }
+    dut->valid_if(valid_if);
+    dut->squash_if(squash_if);
+    dut->thread_if(thread_if);
     dut->pc_if(pc_if);
     dut->instruction_if(instruction_if);
+    dut->lane1_instruction_if(lane1_instruction_if);
+    dut->rom_read_if(rom_read_if);
+    dut->prefetch_issued_if(prefetch_issued_if);
+    dut->prefetch_used_if(prefetch_used_if);
+    dut->prefetch_discarded_if(prefetch_discarded_if);
+    dut->instruction_request_valid_if(instruction_request_valid_if);
+    dut->instruction_request_address_if(instruction_request_address_if);
 
     nrst = 1;
+    ce = 1;
+    ce_core = 1;
     stall = 0;
     branch_taken_ex = 0;
     branch_target_ex = 0;
+    flush_if = 0;
     for(const auto& [data, sig]: std::views::zip(ROM, rom)) {
         sig = data;
     }
@@ -106,6 +147,7 @@ int sc_main(int argc, char* argv[]) {
     sc_start(1, SC_NS);
     assert(dut->pc_if.read() == Fetch::PC_RESET_VALUE);
     assert(dut->instruction_if.read() == 0);
+    assert(dut->valid_if.read() == false);
     nrst = 1;
     sc_start(1, SC_NS);
 
@@ -115,18 +157,21 @@ int sc_main(int argc, char* argv[]) {
     sc_start(5, SC_NS);
     assert(dut->pc_if.read() == 0);
     assert(dut->instruction_if.read() == 0);
+    assert(dut->valid_if.read() == false);
     sc_start(5, SC_NS);
 
     stall = 1;
     sc_start(5, SC_NS);
     assert(dut->pc_if.read() == 0);
     assert(dut->instruction_if.read() == 0);
+    assert(dut->valid_if.read() == false);
     sc_start(5, SC_NS);
 
     stall = 1;
     sc_start(5, SC_NS);
     assert(dut->pc_if.read() == 0);
     assert(dut->instruction_if.read() == 0);
+    assert(dut->valid_if.read() == false);
     sc_start(5, SC_NS);
 
 
@@ -136,6 +181,7 @@ int sc_main(int argc, char* argv[]) {
         sc_start(5, SC_NS);
         assert(dut->pc_if.read() == i * 4);
         assert(dut->instruction_if.read() == cc(chunk[0].read(), chunk[1].read(), chunk[2].read(), chunk[3].read()));
+        assert(dut->valid_if.read() == true);
         sc_start(5, SC_NS);
     }
 
@@ -144,6 +190,7 @@ int sc_main(int argc, char* argv[]) {
     sc_start(8, SC_NS);
     assert(dut->pc_if.read() == Fetch::PC_RESET_VALUE);
     assert(dut->instruction_if.read() == 0);
+    assert(dut->valid_if.read() == false);
     nrst = 1;
     sc_start(1, SC_NS);
 
@@ -154,6 +201,7 @@ int sc_main(int argc, char* argv[]) {
         sc_start(5, SC_NS);
         assert(dut->pc_if.read() == i * 4);
         assert(dut->instruction_if.read() == cc(chunk[0].read(), chunk[1].read(), chunk[2].read(), chunk[3].read()));
+        assert(dut->valid_if.read() == true);
         sc_start(5, SC_NS);
     }
 
@@ -161,25 +209,31 @@ int sc_main(int argc, char* argv[]) {
     static_assert((BRANCH_TARGET < sizeof(ROM)) && ((BRANCH_TARGET % 4) == 0));
     branch_target_ex = BRANCH_TARGET;
 
+    // a stalled fetch keeps the last word and only drops valid
+    const auto held_instruction { cc(rom[STALLER - 4].read(), rom[STALLER - 3].read(), rom[STALLER - 2].read(), rom[STALLER - 1].read()) };
+
     stall = 1;
     branch_taken_ex = 0;
     sc_start(5, SC_NS);
     assert(dut->pc_if.read() == STALLER);
-    assert(dut->instruction_if.read() == 0);
+    assert(dut->instruction_if.read() == held_instruction);
+    assert(dut->valid_if.read() == false);
     sc_start(5, SC_NS);
 
     stall = 1;
     branch_taken_ex = 0;
     sc_start(5, SC_NS);
     assert(dut->pc_if.read() == STALLER);
-    assert(dut->instruction_if.read() == 0);
+    assert(dut->instruction_if.read() == held_instruction);
+    assert(dut->valid_if.read() == false);
     sc_start(5, SC_NS);
 
     stall = 1;
     branch_taken_ex = 1;
     sc_start(5, SC_NS);
     assert(dut->pc_if.read() == STALLER);
-    assert(dut->instruction_if.read() == 0);
+    assert(dut->instruction_if.read() == held_instruction);
+    assert(dut->valid_if.read() == false);
     sc_start(5, SC_NS);
 
     stall = 0;
@@ -188,6 +242,7 @@ int sc_main(int argc, char* argv[]) {
         sc_start(5, SC_NS);
         assert(dut->pc_if.read() == BRANCH_TARGET + 4 + (i * 4));
         assert(dut->instruction_if.read() == cc(chunk[0].read(), chunk[1].read(), chunk[2].read(), chunk[3].read()));
+        assert(dut->valid_if.read() == true);
         sc_start(5, SC_NS);
     }
 
@@ -777,6 +777,7 @@ int sc_main(int argc, char* argv[]) {
     // inputs
     sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
     sc_signal<bool> nrst;
+    sc_signal<bool> ce;
     const uint8_t ROM[] {
         // nop; sll $0, $0, 0 type instructions for writeback check
         0x00,0x00,0x00,0x00,
@@ -1042,11 +1043,30 @@ int sc_main(int argc, char* argv[]) {
     static_assert((sizeof(ROM) > 4) && ((sizeof(ROM) % 4) == 0));
     std::vector<sc_signal<sc_bv<8>>> rom(std::extent_v<std::remove_reference_t<decltype(Vmemory::rom)>>);
     sc_signal<bool> stall;
+    sc_signal<bool> console_tx_ready;
+    sc_signal<sc_bv<6>> interrupts;
+    sc_signal<bool> snoop_store;
+    sc_signal<sc_bv<2>> snoop_load_store_data_size_mode;
+    sc_signal<sc_bv<32>> snoop_address;
+    sc_signal<sc_bv<32>> snoop_write_data;
+    sc_signal<bool> instruction_request_ready_if;
+    sc_signal<bool> instruction_response_valid_if;
+    sc_signal<sc_bv<32>> instruction_response_data_if;
+    sc_signal<bool> data_request_ready_ex;
+    sc_signal<bool> data_response_valid_ex;
+    sc_signal<sc_bv<32>> data_response_data_ex;
+    sc_signal<sc_bv<2>> thread_wb;
     sc_signal<bool> rd_wb;
     sc_signal<sc_bv<5>> rd_address_wb;
     sc_signal<sc_bv<32>> rd_data_wb;
+    sc_signal<bool> lane1_rd_wb;
+    sc_signal<sc_bv<5>> lane1_rd_address_wb;
+    sc_signal<sc_bv<32>> lane1_rd_data_wb;
 
     // outputs
+    sc_signal<bool> valid_ex;
+    sc_signal<bool> valid_me;
+    sc_signal<sc_bv<2>> thread_me;
     sc_signal<sc_bv<32>> pc_me;
     std::vector<sc_signal<sc_bv<8>>> ram(std::extent_v<std::remove_reference_t<decltype(Vmemory::ram)>>);
     sc_signal<bool> load_me;
@@ -1055,22 +1075,68 @@ int sc_main(int argc, char* argv[]) {
     sc_signal<bool> rd_me;
     sc_signal<sc_bv<5>> rd_address_me;
     sc_signal<sc_bv<32>> read_data_me;
+    sc_signal<bool> idle_ex;
+    sc_signal<bool> rom_read_if;
+    sc_signal<sc_bv<32>> prefetch_issued_if;
+    sc_signal<sc_bv<32>> prefetch_used_if;
+    sc_signal<sc_bv<32>> prefetch_discarded_if;
+    sc_signal<sc_bv<32>> data_loads_ex;
+    sc_signal<sc_bv<32>> data_prefetch_issued_ex;
+    sc_signal<sc_bv<32>> data_prefetch_useful_ex;
+    sc_signal<bool> tohost_me;
+    sc_signal<sc_bv<32>> tohost_data_me;
+    sc_signal<bool> console_tx_me;
+    sc_signal<sc_bv<8>> console_tx_data_me;
+    sc_signal<bool> instruction_request_valid_if;
+    sc_signal<sc_bv<32>> instruction_request_address_if;
+    sc_signal<bool> data_busy_ex;
+    sc_signal<bool> data_request_ex;
+    sc_signal<bool> data_store_ex;
+    sc_signal<sc_bv<2>> data_load_store_data_size_mode_ex;
+    sc_signal<sc_bv<32>> data_address_ex;
+    sc_signal<sc_bv<32>> data_write_data_ex;
     std::vector<sc_signal<sc_bv<32>>> reg_file(std::extent_v<std::remove_reference_t<decltype(Vmemory::reg_file)>>);
+    sc_signal<bool> lane1_valid_ex;
+    sc_signal<sc_bv<32>> lane1_pc_me;
+    sc_signal<bool> lane1_alu_mode_me;
+    sc_signal<sc_bv<32>> lane1_alu_result_me;
+    sc_signal<bool> lane1_rd_me;
+    sc_signal<sc_bv<5>> lane1_rd_address_me;
 
     const std::unique_ptr<Vmemory> dut{new Vmemory{"memory_context"}};
 
     // inputs
     dut->clk(clk);
     dut->nrst(nrst);
+    dut->ce(ce);
     for(const auto& [port, sig]: std::views::zip(dut->rom, rom)) {
         port(sig);
     }
     dut->stall(stall);
+    dut->console_tx_ready(console_tx_ready);
+    dut->interrupts(interrupts);
+    dut->snoop_store(snoop_store);
+    dut->snoop_load_store_data_size_mode(snoop_load_store_data_size_mode);
+    dut->snoop_address(snoop_address);
+    dut->snoop_write_data(snoop_write_data);
+    dut->instruction_request_ready_if(instruction_request_ready_if);
+    dut->instruction_response_valid_if(instruction_response_valid_if);
+    dut->instruction_response_data_if(instruction_response_data_if);
+    dut->data_request_ready_ex(data_request_ready_ex);
+    dut->data_response_valid_ex(data_response_valid_ex);
+    dut->data_response_data_ex(data_response_data_ex);
+    dut->thread_wb(thread_wb);
     dut->rd_wb(rd_wb);
     dut->rd_address_wb(rd_address_wb);
     dut->rd_data_wb(rd_data_wb);
+    dut->lane1_rd_wb(lane1_rd_wb);
+    dut->lane1_rd_address_wb(lane1_rd_address_wb);
+    dut->lane1_rd_data_wb(lane1_rd_data_wb);
 
     // outputs
+    dut->valid_ex(valid_ex);
+    dut->valid_me(valid_me);
+    dut->thread_me(thread_me);
     dut->pc_me(pc_me);
     for(const auto& [port, sig]: std::views::zip(dut->ram, ram)) {
         port(sig);
@@ -1084,10 +1150,40 @@ int sc_main(int argc, char* argv[]) {
     dut->rd_me(rd_me);
     dut->rd_address_me(rd_address_me);
     dut->read_data_me(read_data_me);
+    dut->idle_ex(idle_ex);
+    dut->rom_read_if(rom_read_if);
+    dut->prefetch_issued_if(prefetch_issued_if);
+    dut->prefetch_used_if(prefetch_used_if);
+    dut->prefetch_discarded_if(prefetch_discarded_if);
+    dut->data_loads_ex(data_loads_ex);
+    dut->data_prefetch_issued_ex(data_prefetch_issued_ex);
+    dut->data_prefetch_useful_ex(data_prefetch_useful_ex);
+    dut->tohost_me(tohost_me);
+    dut->tohost_data_me(tohost_data_me);
+    dut->console_tx_me(console_tx_me);
+    dut->console_tx_data_me(console_tx_data_me);
+    dut->instruction_request_valid_if(instruction_request_valid_if);
+    dut->instruction_request_address_if(instruction_request_address_if);
+    dut->data_busy_ex(data_busy_ex);
+    dut->data_request_ex(data_request_ex);
+    dut->data_store_ex(data_store_ex);
+    dut->data_load_store_data_size_mode_ex(data_load_store_data_size_mode_ex);
+    dut->data_address_ex(data_address_ex);
+    dut->data_write_data_ex(data_write_data_ex);
 
+    dut->lane1_valid_ex(lane1_valid_ex);
+    dut->lane1_pc_me(lane1_pc_me);
+    dut->lane1_alu_mode_me(lane1_alu_mode_me);
+    dut->lane1_alu_result_me(lane1_alu_result_me);
+    dut->lane1_rd_me(lane1_rd_me);
+    dut->lane1_rd_address_me(lane1_rd_address_me);
 
     nrst = 1;
+    ce = 1;
     stall = 0;
+    console_tx_ready = 1;
+    interrupts = 0;
+    snoop_store = 0;
     for(const auto& [data, sig]: std::views::zip(ROM, rom)) {
         sig = data;
     }
@@ -1192,6 +1288,7 @@ int sc_main(int argc, char* argv[]) {
         i == dut;
         sc_start(5, SC_NS);
     }
+    assert(dut->idle_ex.read());
 
     if(tfp) { tfp->flush(); tfp->close(); }
     dut->final();
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+#include "util.hpp"
+
+// Cycle based model of a memory behind a request/response port. Each request
+// responds after a latency drawn from [min_latency, max_latency], at most one
+// request is accepted every issue_interval cycles and responses come back in
+// order. Addresses wrap at the size, which has to be a power of two, and
+// accesses use the same byte lanes as data_memory. Like a bus register the
+// response data keeps the last response after response_valid dropped.
+struct MemoryModel {
+    struct Config {
+        uint32_t min_latency { 1 };
+        uint32_t max_latency { 1 };
+        uint32_t issue_interval { 1 };
+        uint32_t seed { 0 };
+    };
+
+    struct Response {
+        bool request_ready { false };
+        bool response_valid { false };
+        uint32_t response_data { 0 };
+    };
+
+    struct Request {
+        bool valid { false };
+        bool store { false };
+        uint32_t load_store_data_size_mode { Decode::LoadStoreDataSizeMode_WORD };
+        uint32_t address { 0 };
+        uint32_t write_data { 0 };
+    };
+
+    struct InFlight {
+        uint64_t due;
+        uint32_t data;
+    };
+
+    std::vector<uint8_t> bytes;
+    Config config;
+    std::mt19937 rng;
+    std::deque<InFlight> in_flight {};
+    uint32_t last_data { 0 };
+    uint64_t cycle { 0 };
+    uint64_t next_issue { 0 };
+    uint64_t requests { 0 };
+    uint64_t wait_cycles { 0 };
+
+    MemoryModel(const std::size_t size, const Config& config):
+        bytes(size, 0),
+        config { config },
+        rng { config.seed }
+    {}
+
+    void load(const std::vector<uint8_t>& image) {
+        std::fill(bytes.begin(), bytes.end(), 0);
+        std::copy_n(image.begin(), std::min(image.size(), bytes.size()), bytes.begin());
+    }
+
+    uint8_t& at(const uint32_t address) {
+        return bytes[address & (bytes.size() - 1)];
+    }
+
+    // What the port shows during the current cycle, it only depends on the
+    // state left by earlier cycles.
+    Response drive() const {
+        Response ret {};
+        ret.request_ready = (cycle >= next_issue);
+        ret.response_data = last_data;
+        if(!in_flight.empty() && (in_flight.front().due <= cycle)) {
+            ret.response_valid = true;
+            ret.response_data = in_flight.front().data;
+        }
+        return ret;
+    }
+
+    // Takes the request the core presents during the current cycle and
+    // advances to the next one.
+    void commit(const Response& response, const Request& request) {
+        if(response.response_valid) {
+            last_data = in_flight.front().data;
+            in_flight.pop_front();
+        }
+        if(request.valid && !response.request_ready) {
+            wait_cycles++;
+        }
+        if(request.valid && response.request_ready) {
+            uint32_t data { 0 };
+            if(request.store) {
+                if(request.load_store_data_size_mode == Decode::LoadStoreDataSizeMode_WORD) {
+                    at(request.address + 0) = request.write_data >> 24;
+                    at(request.address + 1) = request.write_data >> 16;
+                    at(request.address + 2) = request.write_data >> 8;
+                    at(request.address + 3) = request.write_data;
+                } else if(request.load_store_data_size_mode == Decode::LoadStoreDataSizeMode_HALF_WORD) {
+                    at(request.address + 2) = request.write_data >> 8;
+                    at(request.address + 3) = request.write_data;
+                } else if(request.load_store_data_size_mode == Decode::LoadStoreDataSizeMode_BYTE) {
+                    at(request.address + 3) = request.write_data;
+                }
+            } else {
+                data = (
+                    (static_cast<uint32_t>(at(request.address + 0)) << 24)
+                    | (static_cast<uint32_t>(at(request.address + 1)) << 16)
+                    | (static_cast<uint32_t>(at(request.address + 2)) << 8)
+                    | static_cast<uint32_t>(at(request.address + 3))
+                );
+            }
+            const uint32_t latency { std::uniform_int_distribution<uint32_t> { config.min_latency, config.max_latency }(rng) };
+            const uint64_t due { std::max<uint64_t>(cycle + std::max<uint32_t>(latency, 1), in_flight.empty() ? 0 : in_flight.back().due) };
+            in_flight.push_back({ due, data });
+            next_issue = cycle + std::max<uint32_t>(config.issue_interval, 1);
+            requests++;
+        }
+        cycle++;
+    }
+};
\ No newline at end of file
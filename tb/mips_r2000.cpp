@@ -1,4 +1,5 @@
 #include <memory>
+#include <chrono>
 #include <systemc>
 #include <ranges>
 #include <csignal>
@@ -93,6 +94,7 @@ int sc_main(int argc, char* argv[]) {
     // inputs
     sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
     sc_signal<bool> nrst;
+    sc_signal<bool> ce;
     const std::vector<uint8_t> ROM {
         0x3c,
         0x1d,
@@ -221,15 +223,15 @@ int sc_main(int argc, char* argv[]) {
         0x0c,
         0x00,
         0x00,
-        0xb2,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
+        0xfd,
         0x00,
         0x00,
         0x00,
         0x00,
+        0xac,
+        0x02,
+        0xff,
+        0xf0,
         0x10,
         0x00,
         0xff,
@@ -809,6 +811,306 @@ int sc_main(int argc, char* argv[]) {
         0x27,
         0xbd,
         0xff,
+        0xf8,
+        0xaf,
+        0xbe,
+        0x00,
+        0x04,
+        0x03,
+        0xa0,
+        0xf0,
+        0x25,
+        0xaf,
+        0xc4,
+        0x00,
+        0x08,
+        0x3c,
+        0x02,
+        0xff,
+        0xff,
+        0x34,
+        0x42,
+        0x00,
+        0x08,
+        0x8c,
+        0x42,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x30,
+        0x42,
+        0x00,
+        0x01,
+        0x10,
+        0x40,
+        0xff,
+        0xfa,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x3c,
+        0x02,
+        0xff,
+        0xff,
+        0x34,
+        0x42,
+        0x00,
+        0x0c,
+        0x8f,
+        0xc3,
+        0x00,
+        0x08,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x43,
+        0x00,
+        0x00,
+        0x03,
+        0xc0,
+        0xe8,
+        0x25,
+        0x8f,
+        0xbe,
+        0x00,
+        0x04,
+        0x27,
+        0xbd,
+        0x00,
+        0x08,
+        0x03,
+        0xe0,
+        0x00,
+        0x08,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x27,
+        0xbd,
+        0xff,
+        0xd8,
+        0xaf,
+        0xbf,
+        0x00,
+        0x24,
+        0xaf,
+        0xbe,
+        0x00,
+        0x20,
+        0x03,
+        0xa0,
+        0xf0,
+        0x25,
+        0xaf,
+        0xc4,
+        0x00,
+        0x28,
+        0xaf,
+        0xc5,
+        0x00,
+        0x2c,
+        0xaf,
+        0xc0,
+        0x00,
+        0x10,
+        0x10,
+        0x00,
+        0x00,
+        0x1f,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8f,
+        0xc2,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x02,
+        0x10,
+        0x80,
+        0x8f,
+        0xc3,
+        0x00,
+        0x28,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x62,
+        0x10,
+        0x21,
+        0x8c,
+        0x42,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x30,
+        0x42,
+        0x00,
+        0x0f,
+        0xaf,
+        0xc2,
+        0x00,
+        0x14,
+        0x8f,
+        0xc2,
+        0x00,
+        0x14,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x2c,
+        0x42,
+        0x00,
+        0x0a,
+        0x10,
+        0x40,
+        0x00,
+        0x06,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8f,
+        0xc2,
+        0x00,
+        0x14,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x42,
+        0x00,
+        0x30,
+        0x10,
+        0x00,
+        0x00,
+        0x04,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8f,
+        0xc2,
+        0x00,
+        0x14,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x42,
+        0x00,
+        0x37,
+        0x00,
+        0x40,
+        0x20,
+        0x25,
+        0x0c,
+        0x00,
+        0x00,
+        0xb2,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8f,
+        0xc2,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x42,
+        0x00,
+        0x01,
+        0xaf,
+        0xc2,
+        0x00,
+        0x10,
+        0x8f,
+        0xc3,
+        0x00,
+        0x10,
+        0x8f,
+        0xc2,
+        0x00,
+        0x2c,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x62,
+        0x10,
+        0x2b,
+        0x14,
+        0x40,
+        0xff,
+        0xdd,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x04,
+        0x00,
+        0x0a,
+        0x0c,
+        0x00,
+        0x00,
+        0xb2,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x03,
+        0xc0,
+        0xe8,
+        0x25,
+        0x8f,
+        0xbf,
+        0x00,
+        0x24,
+        0x8f,
+        0xbe,
+        0x00,
+        0x20,
+        0x27,
+        0xbd,
+        0x00,
+        0x28,
+        0x03,
+        0xe0,
+        0x00,
+        0x08,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x27,
+        0xbd,
+        0xff,
         0xc8,
         0xaf,
         0xbf,
@@ -897,15 +1199,79 @@ int sc_main(int argc, char* argv[]) {
         0x0c,
         0x00,
         0x00,
+        0xc7,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x05,
+        0x00,
+        0x08,
+        0x27,
+        0xc2,
+        0x00,
+        0x10,
+        0x00,
+        0x40,
+        0x20,
+        0x25,
+        0x0c,
+        0x00,
+        0x00,
         0x55,
         0x00,
         0x00,
         0x00,
         0x00,
+        0x24,
+        0x05,
         0x00,
+        0x08,
+        0x27,
+        0xc2,
         0x00,
         0x10,
+        0x00,
+        0x40,
+        0x20,
+        0x25,
+        0x0c,
+        0x00,
+        0x00,
+        0xc7,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x05,
+        0x00,
+        0x08,
+        0x27,
+        0xc2,
+        0x00,
+        0x10,
+        0x00,
+        0x40,
+        0x20,
+        0x25,
+        0x0c,
+        0x00,
+        0x00,
         0x25,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x38,
+        0x42,
+        0x00,
+        0x01,
+        0x30,
+        0x42,
+        0x00,
+        0xff,
         0x03,
         0xc0,
         0xe8,
@@ -934,26 +1300,75 @@ int sc_main(int argc, char* argv[]) {
     assert((ROM.size() > 4) && ((ROM.size() % 4) == 0));
     std::vector<sc_signal<sc_bv<8>>> rom(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000::rom)>>);
     sc_signal<bool> stall;
+    sc_signal<bool> console_tx_ready;
+    sc_signal<sc_bv<6>> interrupts;
+    sc_signal<bool> snoop_store;
+    sc_signal<sc_bv<2>> snoop_load_store_data_size_mode;
+    sc_signal<sc_bv<32>> snoop_address;
+    sc_signal<sc_bv<32>> snoop_write_data;
+    sc_signal<bool> instruction_request_ready;
+    sc_signal<bool> instruction_response_valid;
+    sc_signal<sc_bv<32>> instruction_response_data;
+    sc_signal<bool> data_request_ready;
+    sc_signal<bool> data_response_valid;
+    sc_signal<sc_bv<32>> data_response_data;
 
     // outputs
+    sc_signal<bool> valid_wb;
     sc_signal<sc_bv<32>> pc_wb;
     std::vector<sc_signal<sc_bv<8>>> ram(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000::ram)>>);
     std::vector<sc_signal<sc_bv<32>>> reg_file(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000::reg_file)>>);
     sc_signal<bool> rd_wb;
     sc_signal<sc_bv<5>> rd_address_wb;
     sc_signal<sc_bv<32>> rd_data_wb;
+    sc_signal<bool> idle;
+    sc_signal<bool> tohost;
+    sc_signal<sc_bv<32>> tohost_data;
+    sc_signal<bool> console_tx;
+    sc_signal<sc_bv<8>> console_tx_data;
+    sc_signal<sc_bv<32>> cycle_count;
+    sc_signal<sc_bv<32>> instret;
+    sc_signal<sc_bv<32>> bubbles;
+    sc_signal<sc_bv<32>> rom_reads;
+    sc_signal<sc_bv<32>> prefetch_issued;
+    sc_signal<sc_bv<32>> prefetch_used;
+    sc_signal<sc_bv<32>> prefetch_discarded;
+    sc_signal<sc_bv<32>> data_loads;
+    sc_signal<sc_bv<32>> data_prefetch_issued;
+    sc_signal<sc_bv<32>> data_prefetch_useful;
+    sc_signal<bool> instruction_request_valid;
+    sc_signal<sc_bv<32>> instruction_request_address;
+    sc_signal<bool> data_request;
+    sc_signal<bool> data_store;
+    sc_signal<sc_bv<2>> data_load_store_data_size_mode;
+    sc_signal<sc_bv<32>> data_address;
+    sc_signal<sc_bv<32>> data_write_data;
 
     const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"bubble_sort_context"}};
 
     // inputs
     dut->clk(clk);
     dut->nrst(nrst);
+    dut->ce(ce);
     for(const auto& [port, sig]: std::views::zip(dut->rom, rom)) {
         port(sig);
     }
     dut->stall(stall);
+    dut->console_tx_ready(console_tx_ready);
+    dut->interrupts(interrupts);
+    dut->snoop_store(snoop_store);
+    dut->snoop_load_store_data_size_mode(snoop_load_store_data_size_mode);
+    dut->snoop_address(snoop_address);
+    dut->snoop_write_data(snoop_write_data);
+    dut->instruction_request_ready(instruction_request_ready);
+    dut->instruction_response_valid(instruction_response_valid);
+    dut->instruction_response_data(instruction_response_data);
+    dut->data_request_ready(data_request_ready);
+    dut->data_response_valid(data_response_valid);
+    dut->data_response_data(data_response_data);
 
     // outputs
+    dut->valid_wb(valid_wb);
     dut->pc_wb(pc_wb);
     for(const auto& [port, sig]: std::views::zip(dut->ram, ram)) {
         port(sig);
@@ -964,10 +1379,36 @@ int sc_main(int argc, char* argv[]) {
     dut->rd_wb(rd_wb);
     dut->rd_address_wb(rd_address_wb);
     dut->rd_data_wb(rd_data_wb);
+    dut->idle(idle);
+    dut->tohost(tohost);
+    dut->tohost_data(tohost_data);
+    dut->console_tx(console_tx);
+    dut->console_tx_data(console_tx_data);
+    dut->cycle_count(cycle_count);
+    dut->instret(instret);
+    dut->bubbles(bubbles);
+    dut->rom_reads(rom_reads);
+    dut->prefetch_issued(prefetch_issued);
+    dut->prefetch_used(prefetch_used);
+    dut->prefetch_discarded(prefetch_discarded);
+    dut->data_loads(data_loads);
+    dut->data_prefetch_issued(data_prefetch_issued);
+    dut->data_prefetch_useful(data_prefetch_useful);
+    dut->instruction_request_valid(instruction_request_valid);
+    dut->instruction_request_address(instruction_request_address);
+    dut->data_request(data_request);
+    dut->data_store(data_store);
+    dut->data_load_store_data_size_mode(data_load_store_data_size_mode);
+    dut->data_address(data_address);
+    dut->data_write_data(data_write_data);
 
 
     nrst = 1;
+    ce = 1;
     stall = 0;
+    console_tx_ready = 1;
+    interrupts = 0;
+    snoop_store = 0;
     for(const auto& [sig, data]: std::views::zip(rom, ROM)) {
         sig = data;
     }
@@ -979,6 +1420,10 @@ int sc_main(int argc, char* argv[]) {
     tfp->open("logs/mips_r2000_tb.fst");
     std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
 
+    // wall clock time of the whole run, to compare the simulation speed of
+    // the model before and after a change
+    const auto start_time { std::chrono::steady_clock::now() };
+
     // reset
     sc_start(1, SC_NS);
     nrst = 0;
@@ -1021,10 +1466,18 @@ int sc_main(int argc, char* argv[]) {
     sc_start(5, SC_NS);
     sc_start(5, SC_NS);
 
-    // main before calling jal bubble_sort
-    while(dut->pc_wb.read().to_uint() < 0x320U) {
+    Console console {};
+    const auto& step = [&]() {
         sc_start(5, SC_NS);
+        if(dut->console_tx.read()) {
+            console << static_cast<char>(dut->console_tx_data.read().to_uint());
+        }
         sc_start(5, SC_NS);
+    };
+
+    // main before calling jal bubble_sort
+    while(dut->pc_wb.read().to_uint() < 0x460U) {
+        step();
     }
 
     const std::array<uint32_t, 8> DATA { 0x2, 0x5, 0x1, 0xF, 0x7, 0x3, 0xA, 0x0 };
@@ -1041,15 +1494,12 @@ int sc_main(int argc, char* argv[]) {
     };
     assert(std::ranges::equal(DATA, get_array_from_ram_stack()));
 
-    for(uint32_t hang = 0; hang < 3;
-        hang += [&]() {
-            const uint32_t HANG_ADDRESS = 0x8C;
-            return dut->pc_wb.read() == HANG_ADDRESS ? 1 : 0;
-        }()
-    ) {
-        sc_start(5, SC_NS);
-        sc_start(5, SC_NS);
+    // start.s hands the return value of main to tohost
+    while(dut->tohost.read() == false) {
+        step();
     }
+    console.flush();
+    assert(console.output == "251F73A0\n012357AF\n");
     assert(std::ranges::equal(
         [&]() {
             auto copy = DATA;
@@ -1059,7 +1509,17 @@ int sc_main(int argc, char* argv[]) {
         get_array_from_ram_stack()
     ));
 
+    // no stalls, so only the three pipeline fill cycles retire nothing
+    const auto cycle_count = dut->cycle_count.read().to_uint();
+    const auto instret = dut->instret.read().to_uint();
+    std::printf("cycle_count: %u instret: %u CPI: %f\n", cycle_count, instret, static_cast<double>(cycle_count) / instret);
+    const std::chrono::duration<double> runtime { std::chrono::steady_clock::now() - start_time };
+    std::printf("runtime: %f s cycles per second: %f\n", runtime.count(), cycle_count / runtime.count());
+    assert(instret + 3 == cycle_count);
+    assert(dut->bubbles.read().to_uint() == 3);
+
+    const int exit_code = dut->tohost_data.read().to_int();
     if(tfp) { tfp->flush(); tfp->close(); }
     dut->final();
-    return 0;
+    return exit_code;
 }
\ No newline at end of file
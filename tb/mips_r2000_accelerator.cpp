@@ -0,0 +1,293 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // misc/mips_r2000_accelerator/software_sort.s
+    const std::vector<uint8_t> SOFTWARE_SORT_ROM {
+        0x3c,
+        0x08,
+        0x5a,
+        0x03,
+        0x35,
+        0x08,
+        0xf0,
+        0x21,
+        0xac,
+        0x08,
+        0x00,
+        0x40,
+        0x3c,
+        0x08,
+        0x77,
+        0x03,
+        0x35,
+        0x08,
+        0x9c,
+        0x10,
+        0xac,
+        0x08,
+        0x00,
+        0x44,
+        0x24,
+        0x05,
+        0x00,
+        0x47,
+        0x24,
+        0x04,
+        0x00,
+        0x40,
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x90,
+        0x83,
+        0x00,
+        0x00,
+        0x90,
+        0x82,
+        0x00,
+        0x01,
+        0x24,
+        0x84,
+        0x00,
+        0x01,
+        0x00,
+        0x43,
+        0x48,
+        0x2b,
+        0x11,
+        0x20,
+        0x00,
+        0x04,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xa0,
+        0x82,
+        0xff,
+        0xff,
+        0xa0,
+        0x83,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0x14,
+        0x85,
+        0xff,
+        0xf6,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x15,
+        0x00,
+        0xff,
+        0xf2,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((SOFTWARE_SORT_ROM.size() > 4) && ((SOFTWARE_SORT_ROM.size() % 4) == 0));
+    // misc/mips_r2000_accelerator/accelerator_sort.s
+    const std::vector<uint8_t> ACCELERATOR_SORT_ROM {
+        0x3c,
+        0x08,
+        0x5a,
+        0x03,
+        0x35,
+        0x08,
+        0xf0,
+        0x21,
+        0xac,
+        0x08,
+        0x00,
+        0x40,
+        0x3c,
+        0x08,
+        0x77,
+        0x03,
+        0x35,
+        0x08,
+        0x9c,
+        0x10,
+        0xac,
+        0x08,
+        0x00,
+        0x44,
+        0x8c,
+        0x10,
+        0x00,
+        0x40,
+        0x8c,
+        0x11,
+        0x00,
+        0x44,
+        0x24,
+        0x08,
+        0x00,
+        0x04,
+        0x72,
+        0x11,
+        0x90,
+        0x10,
+        0x72,
+        0x11,
+        0x98,
+        0x12,
+        0x72,
+        0x53,
+        0x80,
+        0x11,
+        0x25,
+        0x08,
+        0xff,
+        0xff,
+        0x15,
+        0x00,
+        0xff,
+        0xfb,
+        0x72,
+        0x53,
+        0x88,
+        0x13,
+        0xac,
+        0x10,
+        0x00,
+        0x40,
+        0xac,
+        0x11,
+        0x00,
+        0x44,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((ACCELERATOR_SORT_ROM.size() > 4) && ((ACCELERATOR_SORT_ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"accelerator_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_accelerator_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        std::printf("cycle_count: %u instret: %u IPC: %f\n", cycle_count, instret, static_cast<double>(instret) / cycle_count);
+        return std::pair { cycle_count, instret };
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    const auto& check_sorted = [&]() {
+        assert(get_word(0x40) == 0x0303'1021);
+        assert(get_word(0x44) == 0x5a77'9cf0);
+        assert(dut->tohost_data.read().to_uint() == 0);
+    };
+
+    // Each of the 16 byte_sort instructions waits one cycle in EX for the
+    // registered response of the accelerator.
+    const auto [software_cycle_count, software_instret] = run(SOFTWARE_SORT_ROM);
+    check_sorted();
+    const auto [accelerator_cycle_count, accelerator_instret] = run(ACCELERATOR_SORT_ROM);
+    check_sorted();
+    assert(accelerator_instret == 36);
+    assert(accelerator_instret + 3 + 16 == accelerator_cycle_count);
+    std::printf("software sort cycle_count: %u accelerator sort cycle_count: %u speedup: %f\n", software_cycle_count, accelerator_cycle_count, static_cast<double>(software_cycle_count) / accelerator_cycle_count);
+    assert(accelerator_cycle_count < software_cycle_count);
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
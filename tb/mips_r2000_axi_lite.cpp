@@ -0,0 +1,278 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000_axi_lite.h"
+#include "util.hpp"
+#include "programs.hpp"
+#include "axi_slave_model.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // src/constants.sv
+    constexpr std::size_t ROM_SIZE { 2048 };
+    constexpr std::size_t RAM_SIZE { 128 };
+    // mips_r2000_axi_lite fetches single words
+    constexpr uint32_t LINE_WORDS { 1 };
+
+    // inputs
+    sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
+    sc_signal<bool> nrst;
+    sc_signal<bool> console_tx_ready;
+    sc_signal<bool> instruction_arready;
+    sc_signal<bool> instruction_rvalid;
+    sc_signal<sc_bv<32>> instruction_rdata;
+    sc_signal<sc_bv<2>> instruction_rresp;
+    sc_signal<bool> data_arready;
+    sc_signal<bool> data_rvalid;
+    sc_signal<sc_bv<32>> data_rdata;
+    sc_signal<sc_bv<2>> data_rresp;
+    sc_signal<bool> data_awready;
+    sc_signal<bool> data_wready;
+    sc_signal<bool> data_bvalid;
+    sc_signal<sc_bv<2>> data_bresp;
+
+    // outputs
+    sc_signal<bool> instruction_arvalid;
+    sc_signal<sc_bv<32>> instruction_araddr;
+    sc_signal<sc_bv<3>> instruction_arprot;
+    sc_signal<bool> instruction_rready;
+    sc_signal<bool> data_arvalid;
+    sc_signal<sc_bv<32>> data_araddr;
+    sc_signal<sc_bv<3>> data_arprot;
+    sc_signal<bool> data_rready;
+    sc_signal<bool> data_awvalid;
+    sc_signal<sc_bv<32>> data_awaddr;
+    sc_signal<sc_bv<3>> data_awprot;
+    sc_signal<bool> data_wvalid;
+    sc_signal<sc_bv<32>> data_wdata;
+    sc_signal<sc_bv<4>> data_wstrb;
+    sc_signal<bool> data_bready;
+    sc_signal<bool> valid_wb;
+    sc_signal<sc_bv<32>> pc_wb;
+    sc_signal<bool> idle;
+    sc_signal<bool> tohost;
+    sc_signal<sc_bv<32>> tohost_data;
+    sc_signal<bool> console_tx;
+    sc_signal<sc_bv<8>> console_tx_data;
+    sc_signal<sc_bv<32>> cycle_count;
+    sc_signal<sc_bv<32>> instret;
+    sc_signal<bool> bus_error;
+
+    const std::unique_ptr<Vmips_r2000_axi_lite> dut{new Vmips_r2000_axi_lite{"axi_lite_context"}};
+
+    // inputs
+    dut->clk(clk);
+    dut->nrst(nrst);
+    dut->console_tx_ready(console_tx_ready);
+    dut->instruction_arready(instruction_arready);
+    dut->instruction_rvalid(instruction_rvalid);
+    dut->instruction_rdata(instruction_rdata);
+    dut->instruction_rresp(instruction_rresp);
+    dut->data_arready(data_arready);
+    dut->data_rvalid(data_rvalid);
+    dut->data_rdata(data_rdata);
+    dut->data_rresp(data_rresp);
+    dut->data_awready(data_awready);
+    dut->data_wready(data_wready);
+    dut->data_bvalid(data_bvalid);
+    dut->data_bresp(data_bresp);
+
+    // outputs
+    dut->instruction_arvalid(instruction_arvalid);
+    dut->instruction_araddr(instruction_araddr);
+    dut->instruction_arprot(instruction_arprot);
+    dut->instruction_rready(instruction_rready);
+    dut->data_arvalid(data_arvalid);
+    dut->data_araddr(data_araddr);
+    dut->data_arprot(data_arprot);
+    dut->data_rready(data_rready);
+    dut->data_awvalid(data_awvalid);
+    dut->data_awaddr(data_awaddr);
+    dut->data_awprot(data_awprot);
+    dut->data_wvalid(data_wvalid);
+    dut->data_wdata(data_wdata);
+    dut->data_wstrb(data_wstrb);
+    dut->data_bready(data_bready);
+    dut->valid_wb(valid_wb);
+    dut->pc_wb(pc_wb);
+    dut->idle(idle);
+    dut->tohost(tohost);
+    dut->tohost_data(tohost_data);
+    dut->console_tx(console_tx);
+    dut->console_tx_data(console_tx_data);
+    dut->cycle_count(cycle_count);
+    dut->instret(instret);
+    dut->bus_error(bus_error);
+
+    nrst = 1;
+    console_tx_ready = 1;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_axi_lite_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image, const AxiSlaveModel::Config& config) {
+        AxiSlaveModel instruction_slave { ROM_SIZE, config };
+        instruction_slave.load(image);
+        AxiSlaveModel data_slave { RAM_SIZE, config };
+        instruction_arready = false;
+        instruction_rvalid = false;
+        data_arready = false;
+        data_rvalid = false;
+        data_awready = false;
+        data_wready = false;
+        data_bvalid = false;
+        sc_start(1, SC_NS);
+        nrst = 0;
+        sc_start(1, SC_NS);
+        nrst = 1;
+        sc_start(1, SC_NS);
+
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+
+            const auto instruction_response = instruction_slave.drive();
+            instruction_arready = instruction_response.arready;
+            instruction_rvalid = instruction_response.rvalid;
+            instruction_rdata = instruction_response.rdata;
+            instruction_rresp = instruction_response.rresp;
+            instruction_slave.commit(instruction_response, AxiSlaveModel::Request {
+                .arvalid = dut->instruction_arvalid.read(),
+                .araddr = dut->instruction_araddr.read().to_uint(),
+                .rready = dut->instruction_rready.read()
+            });
+
+            const auto data_response = data_slave.drive();
+            data_arready = data_response.arready;
+            data_rvalid = data_response.rvalid;
+            data_rdata = data_response.rdata;
+            data_rresp = data_response.rresp;
+            data_awready = data_response.awready;
+            data_wready = data_response.wready;
+            data_bvalid = data_response.bvalid;
+            data_bresp = data_response.bresp;
+            data_slave.commit(data_response, AxiSlaveModel::Request {
+                .arvalid = dut->data_arvalid.read(),
+                .araddr = dut->data_araddr.read().to_uint(),
+                .rready = dut->data_rready.read(),
+                .awvalid = dut->data_awvalid.read(),
+                .awaddr = dut->data_awaddr.read().to_uint(),
+                .wvalid = dut->data_wvalid.read(),
+                .wdata = dut->data_wdata.read().to_uint(),
+                .wstrb = dut->data_wstrb.read().to_uint(),
+                .bready = dut->data_bready.read()
+            });
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        std::printf(
+            "latency: %u..%u max_outstanding: %u cycle_count: %u instret: %u CPI: %f instruction_bursts: %lu data_reads: %lu data_writes: %lu max_writes_in_flight: %lu\n",
+            config.min_latency,
+            config.max_latency,
+            config.max_outstanding,
+            cycle_count,
+            instret,
+            static_cast<double>(cycle_count) / instret,
+            instruction_slave.read_bursts,
+            data_slave.read_bursts,
+            data_slave.write_bursts,
+            data_slave.max_writes_in_flight
+        );
+        // AXI4-Lite has no bursts, every read is a single beat
+        assert(instruction_slave.read_beats == instruction_slave.read_bursts * LINE_WORDS);
+        assert(data_slave.read_beats == data_slave.read_bursts);
+        assert(dut->instruction_arprot.read().to_uint() == 0b100);
+        assert(dut->data_arprot.read().to_uint() == 0b000);
+        return std::tuple { cycle_count, instret, instruction_slave, data_slave };
+    };
+
+    const std::array<AxiSlaveModel::Config, 4> CONFIGS {
+        AxiSlaveModel::Config { .min_latency = 1, .max_latency = 1, .max_outstanding = 4, .seed = 0 },
+        AxiSlaveModel::Config { .min_latency = 4, .max_latency = 4, .max_outstanding = 4, .seed = 0 },
+        AxiSlaveModel::Config { .min_latency = 1, .max_latency = 8, .max_outstanding = 2, .seed = 1 },
+        AxiSlaveModel::Config { .min_latency = 2, .max_latency = 20, .max_outstanding = 1, .seed = 2 },
+    };
+
+    // without bursts there is a read for about every instruction
+    for(const auto& config: CONFIGS) {
+        console.output.clear();
+        const auto [cycle_count, instret, instruction_slave, data_slave] = run(BUBBLE_SORT_ROM, config);
+        assert(console.output == "251F73A0\n012357AF\n");
+        assert(dut->tohost_data.read().to_uint() == 0);
+        assert(instruction_slave.read_bursts * 2 > instret);
+        assert(dut->bus_error.read() == false);
+    }
+
+    for(const auto& config: CONFIGS) {
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(ALU_ROM, config);
+        const std::array<uint32_t, 4> RESULTS { 5050, 100, 10100, 5350 };
+        for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+            assert(data_slave.word(i * 4) == data);
+        }
+        // the result stores are posted, with slow write responses the next
+        // one goes out before the previous one was answered
+        if((config.min_latency >= 4) && (config.max_outstanding > 1)) {
+            assert(data_slave.max_writes_in_flight > 1);
+        }
+    }
+
+    // sub-word accesses keep the byte lanes of data_memory, the byte at
+    // address + 3 and the half word at address + 2
+    for(const auto& config: CONFIGS) {
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(LANE_ROM, config);
+        const std::array<uint32_t, 5> RESULTS { 0x1234'5678, 0x0000'00ab, 0x0000'fffe, 0x0000'579b, 0xffff'fffe };
+        for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+            assert(data_slave.word(i * 4) == data);
+        }
+    }
+
+    // the data master keeps rdata after rvalid dropped, the core id, thread
+    // id and console ready loads that follow a RAM load still read alone
+    for(const auto& config: CONFIGS) {
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(MMIO_ROM, config);
+        const std::array<uint32_t, 5> RESULTS { 0x1234'5678, 0x1234'5678, 0x0000'0000, 0x0000'0000, 0x0000'0001 };
+        for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+            assert(data_slave.word(i * 4) == data);
+        }
+    }
+
+    // error responses are flagged on bus_error and stay flagged, the program
+    // itself still runs to the end
+    {
+        auto config = CONFIGS[1];
+        config.slverr = true;
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(ALU_ROM, config);
+        assert(data_slave.word(0) == 5050);
+        assert(dut->bus_error.read() == true);
+    }
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // misc/mips_r2000_barrel/multi_program.s
+    const std::vector<uint8_t> ROM {
+        0x8c,
+        0x10,
+        0xff,
+        0xf8,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0x12,
+        0x00,
+        0x00,
+        0x07,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x12,
+        0x08,
+        0x00,
+        0x0d,
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0x12,
+        0x08,
+        0x00,
+        0x15,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x1d,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x24,
+        0x09,
+        0x00,
+        0x64,
+        0x00,
+        0x49,
+        0x10,
+        0x21,
+        0x25,
+        0x29,
+        0xff,
+        0xff,
+        0x15,
+        0x20,
+        0xff,
+        0xfd,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x1f,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x24,
+        0x0a,
+        0x00,
+        0x01,
+        0x24,
+        0x09,
+        0x00,
+        0x18,
+        0x00,
+        0x4a,
+        0x58,
+        0x21,
+        0x01,
+        0x40,
+        0x10,
+        0x21,
+        0x25,
+        0x29,
+        0xff,
+        0xff,
+        0x15,
+        0x20,
+        0xff,
+        0xfc,
+        0x01,
+        0x60,
+        0x50,
+        0x21,
+        0x10,
+        0x00,
+        0x00,
+        0x15,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x3c,
+        0x09,
+        0xde,
+        0xad,
+        0x35,
+        0x29,
+        0xbe,
+        0xef,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x31,
+        0x2a,
+        0x00,
+        0x01,
+        0x00,
+        0x4a,
+        0x10,
+        0x21,
+        0x00,
+        0x09,
+        0x48,
+        0x42,
+        0x15,
+        0x20,
+        0xff,
+        0xfc,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x0b,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x02,
+        0x04,
+        0x2f,
+        0x24,
+        0x09,
+        0x01,
+        0xce,
+        0x10,
+        0x49,
+        0x00,
+        0x07,
+        0x00,
+        0x49,
+        0x50,
+        0x2b,
+        0x15,
+        0x40,
+        0x00,
+        0x03,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x10,
+        0x00,
+        0xff,
+        0xfb,
+        0x00,
+        0x49,
+        0x10,
+        0x23,
+        0x10,
+        0x00,
+        0xff,
+        0xf9,
+        0x01,
+        0x22,
+        0x48,
+        0x23,
+        0x00,
+        0x10,
+        0x40,
+        0x80,
+        0xad,
+        0x02,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((ROM.size() > 4) && ((ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"multi_program_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+    for(const auto& [sig, data]: std::views::zip(signals.rom, ROM)) {
+        sig = data;
+    }
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_barrel_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    // reset
+    sc_start(1, SC_NS);
+    signals.nrst = 0;
+    sc_start(1, SC_NS);
+    signals.nrst = 1;
+    sc_start(1, SC_NS);
+
+    // every thread stores its exit code to tohost
+    while(dut->tohost.read() == false) {
+        sc_start(5, SC_NS);
+        sc_start(5, SC_NS);
+    }
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    // sum, fibonacci, popcount and gcd, one per thread
+    const std::array<uint32_t, 4> RESULTS { 5050, 46368, 24, 21 };
+    for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+        assert(get_word(i * 4) == data);
+    }
+    // reg_file shows the context of thread 0, $v0
+    assert(dut->reg_file[2 - 1].read().to_uint() == RESULTS[0]);
+
+    // dependent instructions of one thread never meet in the pipeline, so a
+    // valid instruction issues every cycle once the pipeline is filled
+    const auto cycle_count = dut->cycle_count.read().to_uint();
+    const auto instret = dut->instret.read().to_uint();
+    std::printf("cycle_count: %u instret: %u IPC: %f\n", cycle_count, instret, static_cast<double>(instret) / cycle_count);
+    assert(instret + 3 == cycle_count);
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
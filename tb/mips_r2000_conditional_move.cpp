@@ -0,0 +1,538 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // misc/mips_r2000_conditional_move/branch_sort.s
+    const std::vector<uint8_t> BRANCH_SORT_ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0xac,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x08,
+        0x00,
+        0x05,
+        0xac,
+        0x08,
+        0x00,
+        0x44,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0x00,
+        0x48,
+        0x24,
+        0x08,
+        0x00,
+        0x0f,
+        0xac,
+        0x08,
+        0x00,
+        0x4c,
+        0x24,
+        0x08,
+        0x00,
+        0x07,
+        0xac,
+        0x08,
+        0x00,
+        0x50,
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0x00,
+        0x54,
+        0x24,
+        0x08,
+        0x00,
+        0x0a,
+        0xac,
+        0x08,
+        0x00,
+        0x58,
+        0xac,
+        0x00,
+        0x00,
+        0x5c,
+        0x24,
+        0x05,
+        0x00,
+        0x5c,
+        0x24,
+        0x04,
+        0x00,
+        0x40,
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x8c,
+        0x83,
+        0x00,
+        0x00,
+        0x8c,
+        0x82,
+        0x00,
+        0x04,
+        0x24,
+        0x84,
+        0x00,
+        0x04,
+        0x00,
+        0x43,
+        0x48,
+        0x2b,
+        0x11,
+        0x20,
+        0x00,
+        0x04,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x82,
+        0xff,
+        0xfc,
+        0xac,
+        0x83,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0x14,
+        0x85,
+        0xff,
+        0xf6,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x15,
+        0x00,
+        0xff,
+        0xf2,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((BRANCH_SORT_ROM.size() > 4) && ((BRANCH_SORT_ROM.size() % 4) == 0));
+    // misc/mips_r2000_conditional_move/move_sort.s
+    const std::vector<uint8_t> MOVE_SORT_ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0xac,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x08,
+        0x00,
+        0x05,
+        0xac,
+        0x08,
+        0x00,
+        0x44,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0x00,
+        0x48,
+        0x24,
+        0x08,
+        0x00,
+        0x0f,
+        0xac,
+        0x08,
+        0x00,
+        0x4c,
+        0x24,
+        0x08,
+        0x00,
+        0x07,
+        0xac,
+        0x08,
+        0x00,
+        0x50,
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0x00,
+        0x54,
+        0x24,
+        0x08,
+        0x00,
+        0x0a,
+        0xac,
+        0x08,
+        0x00,
+        0x58,
+        0xac,
+        0x00,
+        0x00,
+        0x5c,
+        0x24,
+        0x05,
+        0x00,
+        0x5c,
+        0x24,
+        0x04,
+        0x00,
+        0x40,
+        0x8c,
+        0x83,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x8c,
+        0x82,
+        0x00,
+        0x04,
+        0x24,
+        0x84,
+        0x00,
+        0x04,
+        0x00,
+        0x43,
+        0x48,
+        0x2b,
+        0x00,
+        0x60,
+        0x50,
+        0x25,
+        0x00,
+        0x49,
+        0x50,
+        0x0b,
+        0x00,
+        0x49,
+        0x18,
+        0x0a,
+        0x01,
+        0x09,
+        0x40,
+        0x25,
+        0x14,
+        0x85,
+        0xff,
+        0xf8,
+        0xac,
+        0x8a,
+        0xff,
+        0xfc,
+        0x15,
+        0x00,
+        0xff,
+        0xf3,
+        0xac,
+        0x83,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((MOVE_SORT_ROM.size() > 4) && ((MOVE_SORT_ROM.size() % 4) == 0));
+    // misc/mips_r2000_conditional_move/count_program.s
+    const std::vector<uint8_t> COUNT_ROM {
+        0x3c,
+        0x08,
+        0x00,
+        0x01,
+        0x71,
+        0x09,
+        0x48,
+        0x20,
+        0xac,
+        0x09,
+        0x00,
+        0x00,
+        0x70,
+        0x09,
+        0x48,
+        0x20,
+        0xac,
+        0x09,
+        0x00,
+        0x04,
+        0x24,
+        0x08,
+        0xff,
+        0xff,
+        0x71,
+        0x09,
+        0x48,
+        0x21,
+        0xac,
+        0x09,
+        0x00,
+        0x08,
+        0x3c,
+        0x08,
+        0xff,
+        0xf0,
+        0x71,
+        0x09,
+        0x48,
+        0x21,
+        0xac,
+        0x09,
+        0x00,
+        0x0c,
+        0x71,
+        0x09,
+        0x48,
+        0x20,
+        0xac,
+        0x09,
+        0x00,
+        0x10,
+        0x24,
+        0x0a,
+        0x00,
+        0x07,
+        0x24,
+        0x0b,
+        0x00,
+        0x09,
+        0x01,
+        0x6b,
+        0x50,
+        0x0a,
+        0x01,
+        0x40,
+        0x60,
+        0x21,
+        0xac,
+        0x0c,
+        0x00,
+        0x14,
+        0x01,
+        0x6b,
+        0x50,
+        0x0b,
+        0x01,
+        0x40,
+        0x60,
+        0x21,
+        0xac,
+        0x0c,
+        0x00,
+        0x18,
+        0x00,
+        0x00,
+        0x50,
+        0x0a,
+        0xac,
+        0x0a,
+        0x00,
+        0x1c,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((COUNT_ROM.size() > 4) && ((COUNT_ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"conditional_move_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_conditional_move_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        std::printf("cycle_count: %u instret: %u IPC: %f\n", cycle_count, instret, static_cast<double>(instret) / cycle_count);
+        return std::pair { cycle_count, instret };
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    const auto& check_sorted = [&]() {
+        const std::vector<uint32_t> SORTED { 0, 1, 2, 3, 5, 7, 10, 15 };
+        for(size_t i = 0; i < SORTED.size(); i++) {
+            assert(get_word(0x40 + i * 4) == SORTED[i]);
+        }
+        assert(dut->tohost_data.read().to_uint() == 0);
+    };
+
+    // Counts the branches and jumps inside the innermost loop, the one closed
+    // by the first backward branch of the image.
+    const auto& kernel_branches = [](const std::vector<uint8_t>& image) {
+        const auto& word = [&](const size_t i) {
+            return (uint32_t { image[i * 4 + 0] } << 24)
+                | (uint32_t { image[i * 4 + 1] } << 16)
+                | (uint32_t { image[i * 4 + 2] } << 8)
+                | uint32_t { image[i * 4 + 3] };
+        };
+        const auto& is_branch = [](const uint32_t instruction) {
+            const uint32_t opcode { instruction >> 26 };
+            const uint32_t funct { instruction & 0x3f };
+            return ((opcode >= 1) && (opcode <= 7)) || ((opcode == 0) && ((funct == 0x08) || (funct == 0x09)));
+        };
+        for(size_t i = 0; i < image.size() / 4; i++) {
+            const uint32_t opcode { word(i) >> 26 };
+            const int16_t offset { static_cast<int16_t>(word(i) & 0xffff) };
+            if((opcode == 1 || (opcode >= 4 && opcode <= 7)) && (offset < 0)) {
+                size_t count { 0 };
+                for(size_t j = i + 1 + offset; j < i; j++) {
+                    count += is_branch(word(j));
+                }
+                return count;
+            }
+        }
+        assert(false);
+        return size_t { 0 };
+    };
+
+    // Every taken branch costs the fetch behind its delay slot. The branch
+    // version branches around each swap inside its inner loop, the movn/movz
+    // version has no branch there besides the one closing the loop. Both sort
+    // the same array, the one without branches in its kernel loses fewer
+    // cycles to them and finishes first.
+    assert(kernel_branches(BRANCH_SORT_ROM) != 0);
+    assert(kernel_branches(MOVE_SORT_ROM) == 0);
+    const auto [branch_cycle_count, branch_instret] = run(BRANCH_SORT_ROM);
+    check_sorted();
+    const auto [move_cycle_count, move_instret] = run(MOVE_SORT_ROM);
+    check_sorted();
+    std::printf(
+        "branch sort cycle_count: %u instret: %u lost: %u move sort cycle_count: %u instret: %u lost: %u speedup: %f\n",
+        branch_cycle_count, branch_instret, branch_cycle_count - branch_instret,
+        move_cycle_count, move_instret, move_cycle_count - move_instret,
+        static_cast<double>(branch_cycle_count) / move_cycle_count
+    );
+    assert(branch_instret < branch_cycle_count);
+    assert(move_instret < move_cycle_count);
+    assert((move_cycle_count - move_instret) < (branch_cycle_count - branch_instret));
+    assert(move_cycle_count < branch_cycle_count);
+
+    run(COUNT_ROM);
+    assert(dut->tohost_data.read().to_uint() == 0);
+    const std::vector<uint32_t> COUNTS { 15, 32, 32, 12, 0, 7, 9, 0 };
+    for(size_t i = 0; i < COUNTS.size(); i++) {
+        assert(get_word(i * 4) == COUNTS[i]);
+    }
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
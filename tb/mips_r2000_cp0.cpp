@@ -0,0 +1,1230 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // misc/mips_r2000_cp0/exception_program.s
+    const std::vector<uint8_t> EXCEPTION_ROM {
+        0x08,
+        0x00,
+        0x00,
+        0x2b,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x40,
+        0x1a,
+        0x68,
+        0x00,
+        0x40,
+        0x1b,
+        0x70,
+        0x00,
+        0xae,
+        0x3a,
+        0x00,
+        0x00,
+        0xae,
+        0x3b,
+        0x00,
+        0x04,
+        0x26,
+        0x31,
+        0x00,
+        0x08,
+        0x07,
+        0x41,
+        0x00,
+        0x02,
+        0x27,
+        0x7b,
+        0x00,
+        0x04,
+        0x27,
+        0x7b,
+        0x00,
+        0x04,
+        0x40,
+        0x9b,
+        0x70,
+        0x00,
+        0x26,
+        0x10,
+        0x00,
+        0x01,
+        0x42,
+        0x00,
+        0x00,
+        0x18,
+        0x24,
+        0x10,
+        0x00,
+        0x00,
+        0x24,
+        0x11,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x0c,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0x00,
+        0x00,
+        0x00,
+        0x0d,
+        0x3c,
+        0x09,
+        0x7f,
+        0xff,
+        0x35,
+        0x29,
+        0xff,
+        0xff,
+        0x24,
+        0x0a,
+        0x00,
+        0x22,
+        0x01,
+        0x28,
+        0x50,
+        0x20,
+        0x01,
+        0x28,
+        0x58,
+        0x21,
+        0x24,
+        0x0c,
+        0x00,
+        0x02,
+        0x24,
+        0x0d,
+        0x00,
+        0x55,
+        0x8d,
+        0x8d,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x40,
+        0x0e,
+        0x40,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x01,
+        0x00,
+        0x00,
+        0x00,
+        0x0c,
+        0xac,
+        0x08,
+        0x00,
+        0x40,
+        0xac,
+        0x0a,
+        0x00,
+        0x44,
+        0xac,
+        0x0b,
+        0x00,
+        0x48,
+        0xac,
+        0x0d,
+        0x00,
+        0x4c,
+        0xac,
+        0x0e,
+        0x00,
+        0x50,
+        0xac,
+        0x10,
+        0x00,
+        0x54,
+        0x24,
+        0x08,
+        0x00,
+        0x04,
+        0x40,
+        0x88,
+        0x60,
+        0x00,
+        0x42,
+        0x00,
+        0x00,
+        0x10,
+        0x40,
+        0x08,
+        0x60,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x08,
+        0x00,
+        0x58,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((EXCEPTION_ROM.size() > 4) && ((EXCEPTION_ROM.size() % 4) == 0));
+    // misc/mips_r2000_cp0/interrupt_program.s
+    const std::vector<uint8_t> INTERRUPT_ROM {
+        0x08,
+        0x00,
+        0x00,
+        0xae,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0xff,
+        0xf0,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x40,
+        0x1a,
+        0x68,
+        0x00,
+        0x40,
+        0x1b,
+        0x70,
+        0x00,
+        0xac,
+        0x1a,
+        0x00,
+        0x10,
+        0xac,
+        0x1b,
+        0x00,
+        0x14,
+        0x40,
+        0x80,
+        0x68,
+        0x00,
+        0x26,
+        0x10,
+        0x00,
+        0x01,
+        0x42,
+        0x00,
+        0x00,
+        0x18,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x40,
+        0x1a,
+        0x68,
+        0x00,
+        0x40,
+        0x1b,
+        0x70,
+        0x00,
+        0xac,
+        0x1a,
+        0x00,
+        0x00,
+        0xac,
+        0x1b,
+        0x00,
+        0x04,
+        0x26,
+        0x10,
+        0x00,
+        0x01,
+        0x42,
+        0x00,
+        0x00,
+        0x18,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x40,
+        0x1a,
+        0x68,
+        0x00,
+        0x40,
+        0x1b,
+        0x70,
+        0x00,
+        0xac,
+        0x1a,
+        0x00,
+        0x08,
+        0xac,
+        0x1b,
+        0x00,
+        0x0c,
+        0x26,
+        0x10,
+        0x00,
+        0x01,
+        0x42,
+        0x00,
+        0x00,
+        0x18,
+        0x24,
+        0x10,
+        0x00,
+        0x00,
+        0x34,
+        0x08,
+        0x25,
+        0x01,
+        0x40,
+        0x88,
+        0x60,
+        0x00,
+        0x12,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x09,
+        0x00,
+        0x01,
+        0x12,
+        0x09,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x01,
+        0x00,
+        0x40,
+        0x88,
+        0x68,
+        0x00,
+        0x24,
+        0x0a,
+        0x00,
+        0x55,
+        0xac,
+        0x0a,
+        0x00,
+        0x18,
+        0xac,
+        0x10,
+        0x00,
+        0x1c,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((INTERRUPT_ROM.size() > 4) && ((INTERRUPT_ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"cp0_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_cp0_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& reset = [&](const std::vector<uint8_t>& image) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+    };
+
+    const auto& step = [&]() {
+        sc_start(5, SC_NS);
+        if(dut->console_tx.read()) {
+            console << static_cast<char>(dut->console_tx_data.read().to_uint());
+        }
+        sc_start(5, SC_NS);
+    };
+
+    const auto& retired = [&](const uint32_t pc) {
+        return dut->valid_wb.read() && (dut->pc_wb.read().to_uint() == pc);
+    };
+
+    const auto& finish = [&]() {
+        while(dut->tohost.read() == false) {
+            step();
+        }
+        console.flush();
+        std::printf("cycle_count: %u instret: %u\n", dut->cycle_count.read().to_uint(), dut->instret.read().to_uint());
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    // every exception is logged as Cause and EPC, the last one is a syscall
+    // in the delay slot of the branch at 0xec. Exceptions are taken while the
+    // instruction is in EX, not at writeback: the older instructions in ME and
+    // WB still retire, the faulting one and the word behind it in IF never do,
+    // so the handler sees the same state as with a writeback exception.
+    reset(EXCEPTION_ROM);
+    finish();
+    assert(dut->tohost_data.read().to_uint() == 0);
+    const std::vector<std::pair<uint32_t, uint32_t>> EXCEPTIONS {
+        { 0x0000'0020, 0xb8 },
+        { 0x0000'0024, 0xc0 },
+        { 0x0000'0030, 0xd0 },
+        { 0x0000'0010, 0xe0 },
+        { 0x8000'0020, 0xec },
+    };
+    for(size_t i = 0; i < EXCEPTIONS.size(); i++) {
+        assert(get_word(i * 8 + 0) == EXCEPTIONS[i].first);
+        assert(get_word(i * 8 + 4) == EXCEPTIONS[i].second);
+    }
+    assert(get_word(0x40) == 1);
+    assert(get_word(0x44) == 0x22);
+    assert(get_word(0x48) == 0x8000'0000);
+    assert(get_word(0x4c) == 0x55);
+    assert(get_word(0x50) == 2);
+    assert(get_word(0x54) == 5);
+    assert(get_word(0x58) == 1);
+
+    // The line is raised while the core spins in a wait loop and dropped once
+    // the first instruction of its vector retires. The interrupt is taken on
+    // the instruction in EX, so the vector is fetched in the same cycle and
+    // retires 4 cycles after the line went up.
+    constexpr uint32_t MAX_INTERRUPT_LATENCY { 4 };
+    const auto& interrupt = [&](const uint32_t line, const uint32_t wait_pc, const uint32_t vector) {
+        while(!retired(wait_pc)) {
+            step();
+        }
+        for(size_t i = 0; i < 8; i++) {
+            step();
+        }
+        signals.interrupts = 1 << line;
+        uint32_t latency { 0 };
+        while(!retired(vector)) {
+            step();
+            latency++;
+        }
+        signals.interrupts = 0;
+        std::printf("interrupt line %u entry latency: %u cycles\n", line, latency);
+        assert(latency <= MAX_INTERRUPT_LATENCY);
+    };
+
+    reset(INTERRUPT_ROM);
+    interrupt(0, 0x2c4, 0x240);
+    interrupt(3, 0x2d0, 0x2a0);
+    finish();
+    assert(dut->tohost_data.read().to_uint() == 0);
+    assert((get_word(0x00) & 0x7fff'ffff) == 0x0000'0400);
+    assert(get_word(0x04) == 0x2c4);
+    assert((get_word(0x08) & 0x7fff'ffff) == 0x0000'2000);
+    assert(get_word(0x0c) == 0x2d0);
+    assert(get_word(0x10) == 0x0000'0100);
+    assert(get_word(0x14) == 0x2e0);
+    assert(get_word(0x18) == 0x55);
+    assert(get_word(0x1c) == 3);
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
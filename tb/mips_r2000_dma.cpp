@@ -0,0 +1,425 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // misc/mips_r2000_dma/dma_program.s
+    const std::vector<uint8_t> DMA_ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x3c,
+        0x09,
+        0x01,
+        0x02,
+        0x35,
+        0x29,
+        0x03,
+        0x04,
+        0x24,
+        0x0a,
+        0x00,
+        0x30,
+        0xad,
+        0x09,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x15,
+        0x0a,
+        0xff,
+        0xfd,
+        0x01,
+        0x29,
+        0x48,
+        0x21,
+        0xac,
+        0x00,
+        0xff,
+        0xc0,
+        0x24,
+        0x08,
+        0x00,
+        0x40,
+        0xac,
+        0x08,
+        0xff,
+        0xc4,
+        0xac,
+        0x0a,
+        0xff,
+        0xc8,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0xff,
+        0xd0,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x24,
+        0x0b,
+        0x00,
+        0x0a,
+        0x00,
+        0x4b,
+        0x10,
+        0x21,
+        0xac,
+        0x02,
+        0x00,
+        0x7c,
+        0x25,
+        0x6b,
+        0xff,
+        0xff,
+        0x15,
+        0x60,
+        0xff,
+        0xfc,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8c,
+        0x08,
+        0xff,
+        0xd0,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x31,
+        0x08,
+        0x00,
+        0x01,
+        0x15,
+        0x00,
+        0xff,
+        0xfc,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x30,
+        0xac,
+        0x08,
+        0xff,
+        0xc4,
+        0x24,
+        0x08,
+        0x00,
+        0x10,
+        0xac,
+        0x08,
+        0xff,
+        0xc8,
+        0x3c,
+        0x08,
+        0xa5,
+        0xa5,
+        0x35,
+        0x08,
+        0xa5,
+        0xa5,
+        0xac,
+        0x08,
+        0xff,
+        0xcc,
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0xff,
+        0xd0,
+        0x8c,
+        0x08,
+        0xff,
+        0xd0,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x31,
+        0x08,
+        0x00,
+        0x01,
+        0x15,
+        0x00,
+        0xff,
+        0xfc,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((DMA_ROM.size() > 4) && ((DMA_ROM.size() % 4) == 0));
+    // misc/mips_r2000_dma/software_program.s
+    const std::vector<uint8_t> SOFTWARE_ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x3c,
+        0x09,
+        0x01,
+        0x02,
+        0x35,
+        0x29,
+        0x03,
+        0x04,
+        0x24,
+        0x0a,
+        0x00,
+        0x30,
+        0xad,
+        0x09,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x15,
+        0x0a,
+        0xff,
+        0xfd,
+        0x01,
+        0x29,
+        0x48,
+        0x21,
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x24,
+        0x0b,
+        0x00,
+        0x40,
+        0x8d,
+        0x0c,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0xad,
+        0x6c,
+        0x00,
+        0x00,
+        0x15,
+        0x0a,
+        0xff,
+        0xfc,
+        0x25,
+        0x6b,
+        0x00,
+        0x04,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x24,
+        0x0b,
+        0x00,
+        0x0a,
+        0x00,
+        0x4b,
+        0x10,
+        0x21,
+        0xac,
+        0x02,
+        0x00,
+        0x7c,
+        0x25,
+        0x6b,
+        0xff,
+        0xff,
+        0x15,
+        0x60,
+        0xff,
+        0xfc,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x30,
+        0x24,
+        0x0b,
+        0x00,
+        0x40,
+        0x3c,
+        0x09,
+        0xa5,
+        0xa5,
+        0x35,
+        0x29,
+        0xa5,
+        0xa5,
+        0xad,
+        0x09,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x15,
+        0x0b,
+        0xff,
+        0xfd,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((SOFTWARE_ROM.size() > 4) && ((SOFTWARE_ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"dma_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_dma_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        std::printf("cycle_count: %u instret: %u IPC: %f\n", cycle_count, instret, static_cast<double>(instret) / cycle_count);
+        return std::pair { cycle_count, instret };
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    // both programs leave the same RAM behind, the engine copies a word per
+    // cycle next to the core while the loops take several instructions per
+    // word
+    const auto& check = [&]() {
+        uint32_t word { 0x0102'0304 };
+        for(size_t i = 0; i < 12; i++) {
+            assert(get_word(i * 4) == word);
+            assert(get_word(0x40 + i * 4) == word);
+            word += word;
+        }
+        for(size_t i = 0; i < 4; i++) {
+            assert(get_word(0x30 + i * 4) == 0xa5a5'a5a5);
+        }
+        assert(get_word(0x7c) == 55);
+    };
+
+    // the DMA program runs first, RAM is not cleared on reset and the loops
+    // would leave the expected words behind
+    const auto [dma_cycle_count, dma_instret] = run(DMA_ROM);
+    check();
+    const auto [software_cycle_count, software_instret] = run(SOFTWARE_ROM);
+    check();
+    std::printf("software cycle_count: %u DMA cycle_count: %u speedup: %f\n", software_cycle_count, dma_cycle_count, static_cast<double>(software_cycle_count) / dma_cycle_count);
+    assert(dma_cycle_count < software_cycle_count);
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
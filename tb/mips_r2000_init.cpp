@@ -0,0 +1,270 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // -GINIT_DATA_SOURCE, _idata of misc/mips_r2000_init/init.ld
+    constexpr std::size_t DATA_SOURCE { 0x100 };
+    // 8 words of .data and 16 words of .bss
+    constexpr uint32_t INIT_WORDS { 8 + 16 };
+
+    // misc/mips_r2000_init/init_program.s
+    const std::vector<uint8_t> INIT_ROM {
+        0x3c,
+        0x08,
+        0x80,
+        0x00,
+        0x25,
+        0x09,
+        0x00,
+        0x20,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x8d,
+        0x0a,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x15,
+        0x09,
+        0xff,
+        0xfd,
+        0x00,
+        0x4a,
+        0x10,
+        0x21,
+        0x25,
+        0x09,
+        0x00,
+        0x40,
+        0x24,
+        0x03,
+        0x00,
+        0x00,
+        0x8d,
+        0x0a,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x15,
+        0x09,
+        0xff,
+        0xfd,
+        0x00,
+        0x6a,
+        0x18,
+        0x25,
+        0xad,
+        0x02,
+        0x00,
+        0x00,
+        0xad,
+        0x03,
+        0x00,
+        0x04,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((INIT_ROM.size() > 4) && ((INIT_ROM.size() % 4) == 0));
+    // misc/mips_r2000_init/init_program.s, .data
+    const std::vector<uint8_t> INIT_DATA {
+        0x00,
+        0x00,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x00,
+        0x20,
+        0x00,
+        0x00,
+        0x00,
+        0x30,
+        0x00,
+        0x00,
+        0x00,
+        0x40,
+        0x00,
+        0x00,
+        0x00,
+        0x50,
+        0x00,
+        0x00,
+        0x00,
+        0x60,
+        0x00,
+        0x00,
+        0x00,
+        0x70,
+        0x00,
+        0x00,
+        0x00,
+        0x80,
+    };
+    assert((INIT_DATA.size() > 4) && ((INIT_DATA.size() % 4) == 0));
+    // misc/mips_r2000_init/dirty_program.s
+    const std::vector<uint8_t> DIRTY_ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x24,
+        0x09,
+        0x00,
+        0x80,
+        0x24,
+        0x0a,
+        0xff,
+        0xff,
+        0xad,
+        0x0a,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x15,
+        0x09,
+        0xff,
+        0xfd,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((DIRTY_ROM.size() > 4) && ((DIRTY_ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"init_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_init_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image, const std::vector<uint8_t>& data_image) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom | std::views::drop(DATA_SOURCE), data_image)) {
+            sig = data;
+        }
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+
+        uint32_t cycles { 0 };
+        while(dut->tohost.read() == false) {
+            cycles++;
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        std::printf("cycles: %u cycle_count: %u instret: %u\n", cycles, cycle_count, instret);
+        return std::tuple { cycles, cycle_count, instret };
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    // the dirty program fills RAM with ones after its own initialization, the
+    // next reset has to bring back .data and clear .bss before the first
+    // instruction runs
+    run(DIRTY_ROM, {});
+    for(size_t i = 0; i < signals.ram.size(); i += 4) {
+        assert(get_word(i) == 0xffff'ffff);
+    }
+    const auto [cycles, cycle_count, instret] = run(INIT_ROM, INIT_DATA);
+    assert(get_word(0x60) == 0x240);
+    assert(get_word(0x64) == 0);
+
+    // the pipeline only starts once a word per cycle went into RAM, give or
+    // take the cycle reset is released in
+    assert(cycles + 1 >= cycle_count + INIT_WORDS);
+    assert(cycles <= cycle_count + INIT_WORDS + 1);
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
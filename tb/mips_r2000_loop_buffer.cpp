@@ -0,0 +1,120 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "programs.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"loop_buffer_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_loop_buffer_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        const auto rom_reads = dut->rom_reads.read().to_uint();
+        std::printf("cycle_count: %u instret: %u CPI: %f rom_reads: %u\n", cycle_count, instret, static_cast<double>(cycle_count) / instret, rom_reads);
+        return std::tuple { cycle_count, instret, rom_reads };
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    // the inner loops of bubble_sort and the init loops of start.s replay
+    // from the loop buffer
+    {
+        const auto [cycle_count, instret, rom_reads] = run(BUBBLE_SORT_ROM);
+        assert(console.output == "251F73A0\n012357AF\n");
+        assert(dut->tohost_data.read().to_uint() == 0);
+        assert(rom_reads < cycle_count);
+    }
+
+    // only the first taken loop branch, which fills the loop buffer, and the
+    // mispredicted loop exit cost a cycle, every later iteration is replayed
+    // without touching the ROM
+    {
+        const auto [cycle_count, instret, rom_reads] = run(ALU_ROM);
+        const std::array<uint32_t, 4> RESULTS { 5050, 100, 10100, 5350 };
+        for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+            assert(get_word(i * 4) == data);
+        }
+        assert(instret + 3 + 2 == cycle_count);
+        assert(rom_reads * 10 < cycle_count);
+    }
+
+    // b and jal are still followed by the pre-decoder, only the exit beq of
+    // the loop costs a cycle
+    {
+        const auto [cycle_count, instret, rom_reads] = run(JUMP_ROM);
+        assert(get_word(0) == 5050);
+        assert(get_word(4) == 40);
+        assert(instret + 3 + 1 == cycle_count);
+    }
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
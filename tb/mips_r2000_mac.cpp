@@ -0,0 +1,895 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // CYCLES of multiply_accumulate in src/execute.sv
+    constexpr uint32_t MULTIPLY_CYCLES { 4 };
+
+    // misc/mips_r2000_mac/software_program.s
+    const std::vector<uint8_t> SOFTWARE_ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x08,
+        0xff,
+        0xff,
+        0xac,
+        0x08,
+        0x00,
+        0x44,
+        0x24,
+        0x08,
+        0x00,
+        0x04,
+        0xac,
+        0x08,
+        0x00,
+        0x48,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0x00,
+        0x4c,
+        0x24,
+        0x08,
+        0xff,
+        0xfb,
+        0xac,
+        0x08,
+        0x00,
+        0x50,
+        0x24,
+        0x08,
+        0x00,
+        0x09,
+        0xac,
+        0x08,
+        0x00,
+        0x54,
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0xac,
+        0x08,
+        0x00,
+        0x58,
+        0x24,
+        0x08,
+        0xff,
+        0xfa,
+        0xac,
+        0x08,
+        0x00,
+        0x5c,
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0xac,
+        0x08,
+        0x00,
+        0x60,
+        0x24,
+        0x08,
+        0xff,
+        0xfd,
+        0xac,
+        0x08,
+        0x00,
+        0x64,
+        0x24,
+        0x08,
+        0x00,
+        0x05,
+        0xac,
+        0x08,
+        0x00,
+        0x68,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0x00,
+        0x6c,
+        0x24,
+        0x08,
+        0x00,
+        0x07,
+        0xac,
+        0x08,
+        0x00,
+        0x70,
+        0x24,
+        0x08,
+        0xff,
+        0xfe,
+        0xac,
+        0x08,
+        0x00,
+        0x74,
+        0x24,
+        0x08,
+        0x00,
+        0x04,
+        0xac,
+        0x08,
+        0x00,
+        0x78,
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0x00,
+        0x7c,
+        0x24,
+        0x10,
+        0x00,
+        0x40,
+        0x24,
+        0x11,
+        0x00,
+        0x60,
+        0x24,
+        0x12,
+        0x00,
+        0x60,
+        0x24,
+        0x13,
+        0x00,
+        0x00,
+        0x8e,
+        0x24,
+        0x00,
+        0x00,
+        0x8e,
+        0x05,
+        0x00,
+        0x00,
+        0x0c,
+        0x00,
+        0x00,
+        0x41,
+        0x26,
+        0x10,
+        0x00,
+        0x04,
+        0x02,
+        0x62,
+        0x98,
+        0x21,
+        0x16,
+        0x12,
+        0xff,
+        0xfa,
+        0x26,
+        0x31,
+        0x00,
+        0x04,
+        0xac,
+        0x13,
+        0x00,
+        0x20,
+        0x24,
+        0x10,
+        0x00,
+        0x4c,
+        0x24,
+        0x14,
+        0x00,
+        0x60,
+        0x24,
+        0x15,
+        0x00,
+        0x00,
+        0x24,
+        0x17,
+        0x00,
+        0x70,
+        0x24,
+        0x13,
+        0x00,
+        0x00,
+        0x24,
+        0x11,
+        0x00,
+        0x60,
+        0x02,
+        0x00,
+        0xb0,
+        0x25,
+        0x8e,
+        0x24,
+        0x00,
+        0x00,
+        0x8e,
+        0xc5,
+        0x00,
+        0x00,
+        0x0c,
+        0x00,
+        0x00,
+        0x41,
+        0x26,
+        0x31,
+        0x00,
+        0x04,
+        0x02,
+        0x62,
+        0x98,
+        0x21,
+        0x16,
+        0x37,
+        0xff,
+        0xfa,
+        0x26,
+        0xd6,
+        0xff,
+        0xfc,
+        0xae,
+        0xb3,
+        0x00,
+        0x00,
+        0x26,
+        0x10,
+        0x00,
+        0x04,
+        0x16,
+        0x14,
+        0xff,
+        0xf3,
+        0x26,
+        0xb5,
+        0x00,
+        0x04,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x30,
+        0xb9,
+        0x00,
+        0x01,
+        0x13,
+        0x20,
+        0x00,
+        0x02,
+        0x00,
+        0x05,
+        0x28,
+        0x42,
+        0x00,
+        0x44,
+        0x10,
+        0x21,
+        0x14,
+        0xa0,
+        0xff,
+        0xfb,
+        0x00,
+        0x04,
+        0x20,
+        0x40,
+        0x03,
+        0xe0,
+        0x00,
+        0x08,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((SOFTWARE_ROM.size() > 4) && ((SOFTWARE_ROM.size() % 4) == 0));
+    // misc/mips_r2000_mac/mac_program.s
+    const std::vector<uint8_t> MAC_ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x08,
+        0xff,
+        0xff,
+        0xac,
+        0x08,
+        0x00,
+        0x44,
+        0x24,
+        0x08,
+        0x00,
+        0x04,
+        0xac,
+        0x08,
+        0x00,
+        0x48,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0x00,
+        0x4c,
+        0x24,
+        0x08,
+        0xff,
+        0xfb,
+        0xac,
+        0x08,
+        0x00,
+        0x50,
+        0x24,
+        0x08,
+        0x00,
+        0x09,
+        0xac,
+        0x08,
+        0x00,
+        0x54,
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0xac,
+        0x08,
+        0x00,
+        0x58,
+        0x24,
+        0x08,
+        0xff,
+        0xfa,
+        0xac,
+        0x08,
+        0x00,
+        0x5c,
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0xac,
+        0x08,
+        0x00,
+        0x60,
+        0x24,
+        0x08,
+        0xff,
+        0xfd,
+        0xac,
+        0x08,
+        0x00,
+        0x64,
+        0x24,
+        0x08,
+        0x00,
+        0x05,
+        0xac,
+        0x08,
+        0x00,
+        0x68,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0x00,
+        0x6c,
+        0x24,
+        0x08,
+        0x00,
+        0x07,
+        0xac,
+        0x08,
+        0x00,
+        0x70,
+        0x24,
+        0x08,
+        0xff,
+        0xfe,
+        0xac,
+        0x08,
+        0x00,
+        0x74,
+        0x24,
+        0x08,
+        0x00,
+        0x04,
+        0xac,
+        0x08,
+        0x00,
+        0x78,
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0x00,
+        0x7c,
+        0x24,
+        0x10,
+        0x00,
+        0x40,
+        0x24,
+        0x11,
+        0x00,
+        0x60,
+        0x24,
+        0x12,
+        0x00,
+        0x60,
+        0x00,
+        0x00,
+        0x00,
+        0x13,
+        0x00,
+        0x00,
+        0x00,
+        0x11,
+        0x8e,
+        0x24,
+        0x00,
+        0x00,
+        0x8e,
+        0x05,
+        0x00,
+        0x00,
+        0x26,
+        0x10,
+        0x00,
+        0x04,
+        0x70,
+        0x85,
+        0x00,
+        0x00,
+        0x16,
+        0x12,
+        0xff,
+        0xfb,
+        0x26,
+        0x31,
+        0x00,
+        0x04,
+        0x00,
+        0x00,
+        0x98,
+        0x12,
+        0xac,
+        0x13,
+        0x00,
+        0x20,
+        0x24,
+        0x10,
+        0x00,
+        0x4c,
+        0x24,
+        0x14,
+        0x00,
+        0x60,
+        0x24,
+        0x15,
+        0x00,
+        0x00,
+        0x24,
+        0x17,
+        0x00,
+        0x70,
+        0x00,
+        0x00,
+        0x00,
+        0x13,
+        0x00,
+        0x00,
+        0x00,
+        0x11,
+        0x24,
+        0x11,
+        0x00,
+        0x60,
+        0x02,
+        0x00,
+        0xb0,
+        0x25,
+        0x8e,
+        0x24,
+        0x00,
+        0x00,
+        0x8e,
+        0xc5,
+        0x00,
+        0x00,
+        0x26,
+        0x31,
+        0x00,
+        0x04,
+        0x70,
+        0x85,
+        0x00,
+        0x00,
+        0x16,
+        0x37,
+        0xff,
+        0xfb,
+        0x26,
+        0xd6,
+        0xff,
+        0xfc,
+        0x00,
+        0x00,
+        0x98,
+        0x12,
+        0xae,
+        0xb3,
+        0x00,
+        0x00,
+        0x26,
+        0x10,
+        0x00,
+        0x04,
+        0x16,
+        0x14,
+        0xff,
+        0xf2,
+        0x26,
+        0xb5,
+        0x00,
+        0x04,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((MAC_ROM.size() > 4) && ((MAC_ROM.size() % 4) == 0));
+    // misc/mips_r2000_mac/check_program.s
+    const std::vector<uint8_t> CHECK_ROM {
+        0x24,
+        0x08,
+        0xff,
+        0xf9,
+        0x24,
+        0x09,
+        0x00,
+        0x06,
+        0x01,
+        0x09,
+        0x00,
+        0x18,
+        0x00,
+        0x00,
+        0x50,
+        0x12,
+        0x00,
+        0x00,
+        0x58,
+        0x10,
+        0xac,
+        0x0a,
+        0x00,
+        0x00,
+        0xac,
+        0x0b,
+        0x00,
+        0x04,
+        0x01,
+        0x09,
+        0x00,
+        0x19,
+        0x00,
+        0x00,
+        0x58,
+        0x10,
+        0xac,
+        0x0b,
+        0x00,
+        0x08,
+        0x71,
+        0x29,
+        0x00,
+        0x00,
+        0x71,
+        0x29,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x50,
+        0x12,
+        0xac,
+        0x0a,
+        0x00,
+        0x0c,
+        0x71,
+        0x09,
+        0x00,
+        0x04,
+        0x00,
+        0x00,
+        0x50,
+        0x12,
+        0x00,
+        0x00,
+        0x58,
+        0x10,
+        0xac,
+        0x0a,
+        0x00,
+        0x10,
+        0xac,
+        0x0b,
+        0x00,
+        0x14,
+        0x3c,
+        0x0c,
+        0x80,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x13,
+        0x00,
+        0x00,
+        0x00,
+        0x11,
+        0x71,
+        0x8c,
+        0x00,
+        0x01,
+        0x71,
+        0x8c,
+        0x00,
+        0x01,
+        0x00,
+        0x00,
+        0x58,
+        0x10,
+        0xac,
+        0x0b,
+        0x00,
+        0x18,
+        0x71,
+        0x8c,
+        0x00,
+        0x05,
+        0x00,
+        0x00,
+        0x58,
+        0x10,
+        0x00,
+        0x00,
+        0x50,
+        0x12,
+        0xac,
+        0x0b,
+        0x00,
+        0x1c,
+        0xac,
+        0x0a,
+        0x00,
+        0x20,
+        0x24,
+        0x0d,
+        0x00,
+        0x55,
+        0x01,
+        0xa0,
+        0x00,
+        0x11,
+        0x01,
+        0x20,
+        0x00,
+        0x13,
+        0x00,
+        0x00,
+        0x58,
+        0x10,
+        0x00,
+        0x00,
+        0x50,
+        0x12,
+        0xac,
+        0x0b,
+        0x00,
+        0x24,
+        0xac,
+        0x0a,
+        0x00,
+        0x28,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((CHECK_ROM.size() > 4) && ((CHECK_ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"mac_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_mac_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    // cycle_count and instret as each of the markers retires
+    struct Marker {
+        uint32_t cycle_count;
+        uint32_t instret;
+    };
+    const auto& run = [&](const std::vector<uint8_t>& image, const std::vector<uint32_t>& marker_pcs) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+
+        std::vector<Marker> markers(marker_pcs.size());
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+            for(size_t i = 0; i < marker_pcs.size(); i++) {
+                if(dut->valid_wb.read() && (dut->pc_wb.read().to_uint() == marker_pcs[i])) {
+                    markers[i] = { dut->cycle_count.read().to_uint(), dut->instret.read().to_uint() };
+                }
+            }
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        std::printf("cycle_count: %u instret: %u IPC: %f\n", cycle_count, instret, static_cast<double>(instret) / cycle_count);
+        return markers;
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    const auto& check_results = [&]() {
+        const std::vector<int32_t> FIR { -12, 6, 42, -47, 22 };
+        for(size_t i = 0; i < FIR.size(); i++) {
+            assert(static_cast<int32_t>(get_word(i * 4)) == FIR[i]);
+        }
+        assert(static_cast<int32_t>(get_word(0x20)) == -33);
+        assert(dut->tohost_data.read().to_uint() == 0);
+    };
+
+    // Markers at dot_start, fir_start and done of both programs, the dot
+    // product has 8 taps and the FIR 5 outputs of 4 taps each.
+    constexpr uint32_t DOT_TAPS { 8 };
+    constexpr uint32_t FIR_TAPS { 20 };
+    const auto software = run(SOFTWARE_ROM, { 0x80, 0xb0, 0xf8 });
+    check_results();
+    const auto mac = run(MAC_ROM, { 0x80, 0xb4, 0x100 });
+    check_results();
+
+    const uint32_t software_dot_cycles { software[1].cycle_count - software[0].cycle_count };
+    const uint32_t software_fir_cycles { software[2].cycle_count - software[1].cycle_count };
+    const uint32_t mac_dot_cycles { mac[1].cycle_count - mac[0].cycle_count };
+    const uint32_t mac_fir_cycles { mac[2].cycle_count - mac[1].cycle_count };
+    std::printf(
+        "dot product cycles per tap software: %f mac: %f\n",
+        static_cast<double>(software_dot_cycles) / DOT_TAPS,
+        static_cast<double>(mac_dot_cycles) / DOT_TAPS
+    );
+    std::printf(
+        "FIR cycles per tap software: %f mac: %f\n",
+        static_cast<double>(software_fir_cycles) / FIR_TAPS,
+        static_cast<double>(mac_fir_cycles) / FIR_TAPS
+    );
+
+    // Every madd holds the pipeline while it works through the digits of rt,
+    // the loads feeding it and the mflo right behind the last one lose no
+    // cycle on top.
+    assert(mac_dot_cycles == mac[1].instret - mac[0].instret + DOT_TAPS * (MULTIPLY_CYCLES - 1));
+    assert(mac_fir_cycles == mac[2].instret - mac[1].instret + FIR_TAPS * (MULTIPLY_CYCLES - 1));
+    assert(mac_dot_cycles == 79);
+    assert(mac_fir_cycles == 229);
+    assert(mac_dot_cycles < software_dot_cycles);
+    assert(mac_fir_cycles < software_fir_cycles);
+
+    run(CHECK_ROM, {});
+    assert(dut->tohost_data.read().to_uint() == 0);
+    const std::vector<uint32_t> CHECKS {
+        0xffff'ffd6, 0xffff'ffff, 0x0000'0005, 0x0000'001e, 0x0000'0048, 0x0000'0006,
+        0x8000'0000, 0x4000'0000, 0x0000'0000, 0x0000'0055, 0x0000'0006
+    };
+    for(size_t i = 0; i < CHECKS.size(); i++) {
+        assert(get_word(i * 4) == CHECKS[i]);
+    }
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
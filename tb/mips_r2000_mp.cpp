@@ -0,0 +1,470 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000_mp.h"
+#include "util.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    constexpr size_t CORE_COUNT = std::extent_v<std::remove_reference_t<decltype(Vmips_r2000_mp::pc_wb)>>;
+    const sc_bv<CORE_COUNT> ALL_CORES { (1U << CORE_COUNT) - 1 };
+
+    // inputs
+    sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
+    sc_signal<bool> nrst;
+    // misc/mips_r2000_mp/parallel_sort.s
+    const std::vector<uint8_t> ROM {
+        0x8c,
+        0x10,
+        0xff,
+        0xfc,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x16,
+        0x00,
+        0x00,
+        0x0c,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0x00,
+        0x40,
+        0x24,
+        0x08,
+        0x00,
+        0x02,
+        0xac,
+        0x08,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x05,
+        0xac,
+        0x08,
+        0x00,
+        0x04,
+        0x24,
+        0x08,
+        0x00,
+        0x01,
+        0xac,
+        0x08,
+        0x00,
+        0x08,
+        0x24,
+        0x08,
+        0x00,
+        0x0f,
+        0xac,
+        0x08,
+        0x00,
+        0x0c,
+        0x10,
+        0x00,
+        0x00,
+        0x09,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x07,
+        0xac,
+        0x08,
+        0x00,
+        0x10,
+        0x24,
+        0x08,
+        0x00,
+        0x03,
+        0xac,
+        0x08,
+        0x00,
+        0x14,
+        0x24,
+        0x08,
+        0x00,
+        0x0a,
+        0xac,
+        0x08,
+        0x00,
+        0x18,
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0xac,
+        0x08,
+        0x00,
+        0x1c,
+        0x00,
+        0x10,
+        0x89,
+        0x00,
+        0x24,
+        0x09,
+        0x00,
+        0x03,
+        0x02,
+        0x20,
+        0x50,
+        0x25,
+        0x24,
+        0x0b,
+        0x00,
+        0x03,
+        0x8d,
+        0x4c,
+        0x00,
+        0x00,
+        0x8d,
+        0x4d,
+        0x00,
+        0x04,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x01,
+        0xac,
+        0x70,
+        0x2b,
+        0x11,
+        0xc0,
+        0x00,
+        0x03,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xad,
+        0x4d,
+        0x00,
+        0x00,
+        0xad,
+        0x4c,
+        0x00,
+        0x04,
+        0x25,
+        0x6b,
+        0xff,
+        0xff,
+        0x15,
+        0x60,
+        0xff,
+        0xf6,
+        0x25,
+        0x4a,
+        0x00,
+        0x04,
+        0x25,
+        0x29,
+        0xff,
+        0xff,
+        0x15,
+        0x20,
+        0xff,
+        0xf1,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xc0,
+        0x08,
+        0x00,
+        0x40,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x01,
+        0xe0,
+        0x08,
+        0x00,
+        0x40,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x11,
+        0x00,
+        0xff,
+        0xfa,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x16,
+        0x00,
+        0x00,
+        0x1f,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8c,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x09,
+        0x00,
+        0x02,
+        0x15,
+        0x09,
+        0xff,
+        0xfd,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x24,
+        0x08,
+        0x00,
+        0x00,
+        0x24,
+        0x09,
+        0x00,
+        0x10,
+        0x24,
+        0x0a,
+        0x00,
+        0x20,
+        0x24,
+        0x0f,
+        0x00,
+        0x10,
+        0x11,
+        0x0f,
+        0x00,
+        0x0e,
+        0x24,
+        0x0f,
+        0x00,
+        0x20,
+        0x11,
+        0x2f,
+        0x00,
+        0x07,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8d,
+        0x0c,
+        0x00,
+        0x00,
+        0x8d,
+        0x2d,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x01,
+        0xac,
+        0x70,
+        0x2b,
+        0x15,
+        0xc0,
+        0x00,
+        0x06,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8d,
+        0x0c,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0xad,
+        0x4c,
+        0x00,
+        0x00,
+        0x10,
+        0x00,
+        0x00,
+        0x04,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x8d,
+        0x2d,
+        0x00,
+        0x00,
+        0x25,
+        0x29,
+        0x00,
+        0x04,
+        0xad,
+        0x4d,
+        0x00,
+        0x00,
+        0x25,
+        0x4a,
+        0x00,
+        0x04,
+        0x24,
+        0x0f,
+        0x00,
+        0x40,
+        0x15,
+        0x4f,
+        0xff,
+        0xea,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((ROM.size() > 4) && ((ROM.size() % 4) == 0));
+    std::vector<sc_signal<sc_bv<8>>> rom(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000_mp::rom)>>);
+    sc_signal<sc_bv<CORE_COUNT>> console_tx_ready;
+
+    // outputs
+    std::vector<sc_signal<sc_bv<8>>> ram(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000_mp::ram)>>);
+    std::vector<sc_signal<sc_bv<32>>> pc_wb(CORE_COUNT);
+    sc_signal<sc_bv<CORE_COUNT>> idle;
+    sc_signal<sc_bv<CORE_COUNT>> tohost;
+    std::vector<sc_signal<sc_bv<32>>> tohost_data(CORE_COUNT);
+    sc_signal<sc_bv<CORE_COUNT>> console_tx;
+    std::vector<sc_signal<sc_bv<8>>> console_tx_data(CORE_COUNT);
+    std::vector<sc_signal<sc_bv<32>>> cycle_count(CORE_COUNT);
+    std::vector<sc_signal<sc_bv<32>>> instret(CORE_COUNT);
+
+    const std::unique_ptr<Vmips_r2000_mp> dut{new Vmips_r2000_mp{"parallel_sort_context"}};
+
+    // inputs
+    dut->clk(clk);
+    dut->nrst(nrst);
+    for(const auto& [port, sig]: std::views::zip(dut->rom, rom)) {
+        port(sig);
+    }
+    dut->console_tx_ready(console_tx_ready);
+
+    // outputs
+    for(const auto& [port, sig]: std::views::zip(dut->ram, ram)) {
+        port(sig);
+    }
+    for(const auto& [port, sig]: std::views::zip(dut->pc_wb, pc_wb)) {
+        port(sig);
+    }
+    dut->idle(idle);
+    dut->tohost(tohost);
+    for(const auto& [port, sig]: std::views::zip(dut->tohost_data, tohost_data)) {
+        port(sig);
+    }
+    dut->console_tx(console_tx);
+    for(const auto& [port, sig]: std::views::zip(dut->console_tx_data, console_tx_data)) {
+        port(sig);
+    }
+    for(const auto& [port, sig]: std::views::zip(dut->cycle_count, cycle_count)) {
+        port(sig);
+    }
+    for(const auto& [port, sig]: std::views::zip(dut->instret, instret)) {
+        port(sig);
+    }
+
+    nrst = 1;
+    console_tx_ready = ALL_CORES;
+    for(const auto& [sig, data]: std::views::zip(rom, ROM)) {
+        sig = data;
+    }
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_mp_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    // reset
+    sc_start(1, SC_NS);
+    nrst = 0;
+    sc_start(1, SC_NS);
+    nrst = 1;
+    sc_start(1, SC_NS);
+
+    // every core stores its exit code to tohost
+    while(dut->tohost.read() != ALL_CORES) {
+        sc_start(5, SC_NS);
+        sc_start(5, SC_NS);
+    }
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    // both cores went through the ll/sc barrier at 0x40
+    assert(get_word(0x40) == CORE_COUNT);
+
+    // core 0 merged the two sorted halves into 0x20
+    const std::array<uint32_t, 8> SORTED { 0x0, 0x1, 0x2, 0x3, 0x5, 0x7, 0xA, 0xF };
+    for(const auto& [i, data]: std::views::enumerate(SORTED)) {
+        assert(get_word(0x20 + (i * 4)) == data);
+    }
+
+    for(const auto i: std::views::iota(0U, CORE_COUNT)) {
+        assert(dut->tohost_data[i].read().to_uint() == 0);
+        std::printf(
+            "core %u cycle_count: %u instret: %u\n",
+            i,
+            dut->cycle_count[i].read().to_uint(),
+            dut->instret[i].read().to_uint()
+        );
+    }
+
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "programs.hpp"
+#include "mips_r2000_signals.hpp"
+#include "memory_model.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"prefetch_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_prefetch_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image, const MemoryModel::Config& config) {
+        for(auto& sig: signals.rom) {
+            sig = 0;
+        }
+        for(const auto& [sig, data]: std::views::zip(signals.rom, image)) {
+            sig = data;
+        }
+        MemoryModel instruction_memory { signals.rom.size(), config };
+        instruction_memory.load(image);
+        MemoryModel data_memory { signals.ram.size(), config };
+        signals.instruction_request_ready = false;
+        signals.instruction_response_valid = false;
+        signals.data_request_ready = false;
+        signals.data_response_valid = false;
+        sc_start(1, SC_NS);
+        signals.nrst = 0;
+        sc_start(1, SC_NS);
+        signals.nrst = 1;
+        sc_start(1, SC_NS);
+
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+
+            const auto instruction_response = instruction_memory.drive();
+            signals.instruction_request_ready = instruction_response.request_ready;
+            signals.instruction_response_valid = instruction_response.response_valid;
+            signals.instruction_response_data = instruction_response.response_data;
+            instruction_memory.commit(instruction_response, MemoryModel::Request {
+                .valid = dut->instruction_request_valid.read(),
+                .address = dut->instruction_request_address.read().to_uint()
+            });
+
+            const auto data_response = data_memory.drive();
+            signals.data_request_ready = data_response.request_ready;
+            signals.data_response_valid = data_response.response_valid;
+            signals.data_response_data = data_response.response_data;
+            data_memory.commit(data_response, MemoryModel::Request {
+                .valid = dut->data_request.read(),
+                .store = dut->data_store.read(),
+                .load_store_data_size_mode = dut->data_load_store_data_size_mode.read().to_uint(),
+                .address = dut->data_address.read().to_uint(),
+                .write_data = dut->data_write_data.read().to_uint()
+            });
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        const auto rom_reads = dut->rom_reads.read().to_uint();
+        const auto issued = dut->prefetch_issued.read().to_uint();
+        const auto used = dut->prefetch_used.read().to_uint();
+        const auto discarded = dut->prefetch_discarded.read().to_uint();
+        std::printf(
+            "latency: %u..%u issue_interval: %u cycle_count: %u instret: %u CPI: %f instruction_requests: %lu prefetch_issued: %u prefetch_used: %u prefetch_discarded: %u\n",
+            config.min_latency,
+            config.max_latency,
+            config.issue_interval,
+            cycle_count,
+            instret,
+            static_cast<double>(cycle_count) / instret,
+            instruction_memory.requests,
+            issued,
+            used,
+            discarded
+        );
+        // every accepted request is counted as a read and every prefetched
+        // word is either used, discarded or still buffered
+        assert(rom_reads == instruction_memory.requests);
+        assert(issued <= rom_reads);
+        assert(used + discarded <= issued);
+        assert(issued <= used + discarded + 4);
+        return std::tuple { cycle_count, instret, used, discarded, data_memory };
+    };
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    const std::array<MemoryModel::Config, 4> CONFIGS {
+        MemoryModel::Config { .min_latency = 1, .max_latency = 1, .issue_interval = 1, .seed = 0 },
+        MemoryModel::Config { .min_latency = 4, .max_latency = 4, .issue_interval = 1, .seed = 0 },
+        MemoryModel::Config { .min_latency = 1, .max_latency = 8, .issue_interval = 1, .seed = 1 },
+        MemoryModel::Config { .min_latency = 2, .max_latency = 20, .issue_interval = 4, .seed = 2 },
+    };
+
+    for(const auto& config: CONFIGS) {
+        console.output.clear();
+        const auto [cycle_count, instret, used, discarded, data_memory] = run(BUBBLE_SORT_ROM, config);
+        assert(console.output == "251F73A0\n012357AF\n");
+        assert(dut->tohost_data.read().to_uint() == 0);
+        assert(used > 0);
+    }
+
+    // Without the prefetcher every fetch waits out the whole latency, which
+    // tb/mips_r2000_external_memory.cpp checks as instret * (latency + 1)
+    // cycles on this program. With the stream running ahead only the fetch of
+    // the loop target after each taken bne pays for it.
+    for(const auto& config: CONFIGS) {
+        auto [cycle_count, instret, used, discarded, data_memory] = run(ALU_ROM, config);
+        const std::array<uint32_t, 4> RESULTS { 5050, 100, 10100, 5350 };
+        for(const auto& [j, data]: std::views::enumerate(RESULTS)) {
+            assert(get_word(j * 4) == data);
+            const uint32_t address = j * 4;
+            assert((
+                (static_cast<uint32_t>(data_memory.at(address + 0)) << 24)
+                | (static_cast<uint32_t>(data_memory.at(address + 1)) << 16)
+                | (static_cast<uint32_t>(data_memory.at(address + 2)) << 8)
+                | static_cast<uint32_t>(data_memory.at(address + 3))
+            ) == data);
+        }
+        assert(used > 0);
+        assert(discarded > 0);
+        if((config.min_latency == config.max_latency) && (config.issue_interval == 1)) {
+            assert(cycle_count < instret * (config.min_latency + 1));
+        }
+    }
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
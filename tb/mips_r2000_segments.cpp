@@ -0,0 +1,305 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000.h"
+#include "util.hpp"
+#include "mips_r2000_signals.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // misc/mips_r2000_segments/segments_program.s
+    const std::vector<uint8_t> ROM {
+        0x24,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x0a,
+        0x00,
+        0x01,
+        0xad,
+        0x0a,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x25,
+        0x4a,
+        0x00,
+        0x01,
+        0x2d,
+        0x4b,
+        0x00,
+        0x09,
+        0x15,
+        0x60,
+        0xff,
+        0xfb,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x3c,
+        0x08,
+        0x80,
+        0x00,
+        0x35,
+        0x08,
+        0x00,
+        0x40,
+        0x3c,
+        0x09,
+        0xa0,
+        0x00,
+        0x35,
+        0x29,
+        0x00,
+        0x44,
+        0x24,
+        0x0a,
+        0x00,
+        0x06,
+        0x24,
+        0x0c,
+        0x01,
+        0x00,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x8d,
+        0x0b,
+        0x00,
+        0x00,
+        0xad,
+        0x2c,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x00,
+        0x4b,
+        0x10,
+        0x21,
+        0x25,
+        0x29,
+        0x00,
+        0x04,
+        0x25,
+        0x4a,
+        0xff,
+        0xff,
+        0x15,
+        0x40,
+        0xff,
+        0xf9,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0xac,
+        0x02,
+        0x00,
+        0x00,
+        0x3c,
+        0x08,
+        0x80,
+        0x00,
+        0x35,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x0a,
+        0x00,
+        0x08,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x8d,
+        0x0b,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x25,
+        0x4a,
+        0xff,
+        0xff,
+        0x15,
+        0x40,
+        0xff,
+        0xfc,
+        0x00,
+        0x4b,
+        0x10,
+        0x21,
+        0xac,
+        0x02,
+        0x00,
+        0x04,
+        0x3c,
+        0x08,
+        0xa0,
+        0x00,
+        0x35,
+        0x08,
+        0x00,
+        0x40,
+        0x24,
+        0x0a,
+        0x00,
+        0x08,
+        0x24,
+        0x02,
+        0x00,
+        0x00,
+        0x8d,
+        0x0b,
+        0x00,
+        0x00,
+        0x25,
+        0x08,
+        0x00,
+        0x04,
+        0x25,
+        0x4a,
+        0xff,
+        0xff,
+        0x15,
+        0x40,
+        0xff,
+        0xfc,
+        0x00,
+        0x4b,
+        0x10,
+        0x21,
+        0xac,
+        0x02,
+        0x00,
+        0x08,
+        0xac,
+        0x00,
+        0xff,
+        0xf0,
+        0x10,
+        0x00,
+        0xff,
+        0xff,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    };
+    assert((ROM.size() > 4) && ((ROM.size() % 4) == 0));
+
+    MipsR2000Signals signals {};
+
+    const std::unique_ptr<Vmips_r2000> dut{new Vmips_r2000{"segments_context"}};
+
+    bind_mips_r2000(*dut, signals);
+
+    signals.nrst = 1;
+    signals.ce = 1;
+    signals.stall = 0;
+    signals.console_tx_ready = 1;
+    signals.interrupts = 0;
+    signals.snoop_store = 0;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_segments_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    for(const auto& [sig, data]: std::views::zip(signals.rom, ROM)) {
+        sig = data;
+    }
+    sc_start(1, SC_NS);
+    signals.nrst = 0;
+    sc_start(1, SC_NS);
+    signals.nrst = 1;
+    sc_start(1, SC_NS);
+
+    // data_loads, data_prefetch_issued and data_prefetch_useful once each
+    // of the three loops is done
+    struct Counters {
+        uint32_t loads;
+        uint32_t issued;
+        uint32_t useful;
+    };
+    const std::vector<uint32_t> DONE_PCS { 0x5c, 0x84, 0xac };
+    std::vector<Counters> done(DONE_PCS.size());
+    while(dut->tohost.read() == false) {
+        sc_start(5, SC_NS);
+        if(dut->console_tx.read()) {
+            console << static_cast<char>(dut->console_tx_data.read().to_uint());
+        }
+        for(size_t i = 0; i < DONE_PCS.size(); i++) {
+            if(dut->valid_wb.read() && (dut->pc_wb.read().to_uint() == DONE_PCS[i])) {
+                done[i] = {
+                    dut->data_loads.read().to_uint(),
+                    dut->data_prefetch_issued.read().to_uint(),
+                    dut->data_prefetch_useful.read().to_uint(),
+                };
+            }
+        }
+        sc_start(5, SC_NS);
+    }
+    console.flush();
+    std::printf("cycle_count: %u instret: %u\n", dut->cycle_count.read().to_uint(), dut->instret.read().to_uint());
+    for(const auto& counters: done) {
+        std::printf("data_loads: %u data_prefetch_issued: %u data_prefetch_useful: %u\n", counters.loads, counters.issued, counters.useful);
+    }
+
+    const auto& get_word = [&](const size_t address) {
+        return cc(
+            dut->ram[address + 0].read(),
+            dut->ram[address + 1].read(),
+            dut->ram[address + 2].read(),
+            dut->ram[address + 3].read()
+        ).to_uint();
+    };
+
+    // the stores through kseg1 dropped every word prefetched through kseg0
+    assert(get_word(0x00) == 0x501);
+    assert(done[0].issued > 0);
+    assert(done[0].useful == 0);
+
+    // kseg0 is served by the prefetcher, kseg1 never reaches it
+    assert(get_word(0x04) == 0x609);
+    assert(done[1].useful > done[0].useful);
+    assert(get_word(0x08) == 0x609);
+    assert(done[2].loads == done[1].loads);
+    assert(done[2].issued == done[1].issued);
+    assert(done[2].useful == done[1].useful);
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <ranges>
+#include <systemc>
+#include <type_traits>
+#include <vector>
+#include "Vmips_r2000.h"
+
+// One signal per port of mips_r2000, the testbenches of the core variants
+// all bind the same port list and only differ in how they drive it.
+struct MipsR2000Signals {
+    // inputs
+    sc_core::sc_clock clk{ "clk", sc_core::sc_time { 10.0, sc_core::SC_NS }, 0.5, sc_core::sc_time { 3.0, sc_core::SC_NS } };
+    sc_core::sc_signal<bool> nrst;
+    sc_core::sc_signal<bool> ce;
+    std::vector<sc_core::sc_signal<sc_dt::sc_bv<8>>> rom = std::vector<sc_core::sc_signal<sc_dt::sc_bv<8>>>(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000::rom)>>);
+    sc_core::sc_signal<bool> stall;
+    sc_core::sc_signal<bool> console_tx_ready;
+    sc_core::sc_signal<sc_dt::sc_bv<6>> interrupts;
+    sc_core::sc_signal<bool> snoop_store;
+    sc_core::sc_signal<sc_dt::sc_bv<2>> snoop_load_store_data_size_mode;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> snoop_address;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> snoop_write_data;
+    sc_core::sc_signal<bool> instruction_request_ready;
+    sc_core::sc_signal<bool> instruction_response_valid;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> instruction_response_data;
+    sc_core::sc_signal<bool> data_request_ready;
+    sc_core::sc_signal<bool> data_response_valid;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> data_response_data;
+
+    // outputs
+    sc_core::sc_signal<bool> valid_wb;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> pc_wb;
+    std::vector<sc_core::sc_signal<sc_dt::sc_bv<8>>> ram = std::vector<sc_core::sc_signal<sc_dt::sc_bv<8>>>(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000::ram)>>);
+    std::vector<sc_core::sc_signal<sc_dt::sc_bv<32>>> reg_file = std::vector<sc_core::sc_signal<sc_dt::sc_bv<32>>>(std::extent_v<std::remove_reference_t<decltype(Vmips_r2000::reg_file)>>);
+    sc_core::sc_signal<bool> rd_wb;
+    sc_core::sc_signal<sc_dt::sc_bv<5>> rd_address_wb;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> rd_data_wb;
+    sc_core::sc_signal<bool> idle;
+    sc_core::sc_signal<bool> tohost;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> tohost_data;
+    sc_core::sc_signal<bool> console_tx;
+    sc_core::sc_signal<sc_dt::sc_bv<8>> console_tx_data;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> cycle_count;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> instret;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> bubbles;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> rom_reads;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> prefetch_issued;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> prefetch_used;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> prefetch_discarded;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> data_loads;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> data_prefetch_issued;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> data_prefetch_useful;
+    sc_core::sc_signal<bool> instruction_request_valid;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> instruction_request_address;
+    sc_core::sc_signal<bool> data_request;
+    sc_core::sc_signal<bool> data_store;
+    sc_core::sc_signal<sc_dt::sc_bv<2>> data_load_store_data_size_mode;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> data_address;
+    sc_core::sc_signal<sc_dt::sc_bv<32>> data_write_data;
+};
+
+inline void bind_mips_r2000(Vmips_r2000& dut, MipsR2000Signals& signals) {
+    // inputs
+    dut.clk(signals.clk);
+    dut.nrst(signals.nrst);
+    dut.ce(signals.ce);
+    for(const auto& [port, sig]: std::views::zip(dut.rom, signals.rom)) {
+        port(sig);
+    }
+    dut.stall(signals.stall);
+    dut.console_tx_ready(signals.console_tx_ready);
+    dut.interrupts(signals.interrupts);
+    dut.snoop_store(signals.snoop_store);
+    dut.snoop_load_store_data_size_mode(signals.snoop_load_store_data_size_mode);
+    dut.snoop_address(signals.snoop_address);
+    dut.snoop_write_data(signals.snoop_write_data);
+    dut.instruction_request_ready(signals.instruction_request_ready);
+    dut.instruction_response_valid(signals.instruction_response_valid);
+    dut.instruction_response_data(signals.instruction_response_data);
+    dut.data_request_ready(signals.data_request_ready);
+    dut.data_response_valid(signals.data_response_valid);
+    dut.data_response_data(signals.data_response_data);
+
+    // outputs
+    dut.valid_wb(signals.valid_wb);
+    dut.pc_wb(signals.pc_wb);
+    for(const auto& [port, sig]: std::views::zip(dut.ram, signals.ram)) {
+        port(sig);
+    }
+    for(const auto& [port, sig]: std::views::zip(dut.reg_file, signals.reg_file)) {
+        port(sig);
+    }
+    dut.rd_wb(signals.rd_wb);
+    dut.rd_address_wb(signals.rd_address_wb);
+    dut.rd_data_wb(signals.rd_data_wb);
+    dut.idle(signals.idle);
+    dut.tohost(signals.tohost);
+    dut.tohost_data(signals.tohost_data);
+    dut.console_tx(signals.console_tx);
+    dut.console_tx_data(signals.console_tx_data);
+    dut.cycle_count(signals.cycle_count);
+    dut.instret(signals.instret);
+    dut.bubbles(signals.bubbles);
+    dut.rom_reads(signals.rom_reads);
+    dut.prefetch_issued(signals.prefetch_issued);
+    dut.prefetch_used(signals.prefetch_used);
+    dut.prefetch_discarded(signals.prefetch_discarded);
+    dut.data_loads(signals.data_loads);
+    dut.data_prefetch_issued(signals.data_prefetch_issued);
+    dut.data_prefetch_useful(signals.data_prefetch_useful);
+    dut.instruction_request_valid(signals.instruction_request_valid);
+    dut.instruction_request_address(signals.instruction_request_address);
+    dut.data_request(signals.data_request);
+    dut.data_store(signals.data_store);
+    dut.data_load_store_data_size_mode(signals.data_load_store_data_size_mode);
+    dut.data_address(signals.data_address);
+    dut.data_write_data(signals.data_write_data);
+}
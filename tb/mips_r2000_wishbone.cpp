@@ -0,0 +1,240 @@
+#include <memory>
+#include <systemc>
+#include <ranges>
+#include <csignal>
+#include <vector>
+#include <print>
+#include <verilated.h>
+#include <verilated_fst_sc.h>
+#include "Vmips_r2000_wishbone.h"
+#include "util.hpp"
+#include "programs.hpp"
+#include "wishbone_slave_model.hpp"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+VerilatedFstSc* tfp = nullptr;
+
+int sc_main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::randReset(2);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+    std::ios::sync_with_stdio();
+
+    // src/constants.sv
+    constexpr std::size_t ROM_SIZE { 2048 };
+    constexpr std::size_t RAM_SIZE { 128 };
+
+    // inputs
+    sc_clock clk{ "clk", sc_time { 10.0, SC_NS }, 0.5, sc_time { 3.0, SC_NS } };
+    sc_signal<bool> nrst;
+    sc_signal<bool> console_tx_ready;
+    sc_signal<sc_bv<32>> instruction_dat_r;
+    sc_signal<bool> instruction_ack;
+    sc_signal<bool> instruction_err;
+    sc_signal<sc_bv<32>> data_dat_r;
+    sc_signal<bool> data_ack;
+    sc_signal<bool> data_err;
+
+    // outputs
+    sc_signal<bool> instruction_cyc;
+    sc_signal<bool> instruction_stb;
+    sc_signal<bool> instruction_we;
+    sc_signal<sc_bv<32>> instruction_adr;
+    sc_signal<sc_bv<4>> instruction_sel;
+    sc_signal<sc_bv<32>> instruction_dat_w;
+    sc_signal<bool> data_cyc;
+    sc_signal<bool> data_stb;
+    sc_signal<bool> data_we;
+    sc_signal<sc_bv<32>> data_adr;
+    sc_signal<sc_bv<4>> data_sel;
+    sc_signal<sc_bv<32>> data_dat_w;
+    sc_signal<bool> valid_wb;
+    sc_signal<sc_bv<32>> pc_wb;
+    sc_signal<bool> idle;
+    sc_signal<bool> tohost;
+    sc_signal<sc_bv<32>> tohost_data;
+    sc_signal<bool> console_tx;
+    sc_signal<sc_bv<8>> console_tx_data;
+    sc_signal<sc_bv<32>> cycle_count;
+    sc_signal<sc_bv<32>> instret;
+    sc_signal<bool> bus_error;
+
+    const std::unique_ptr<Vmips_r2000_wishbone> dut{new Vmips_r2000_wishbone{"wishbone_context"}};
+
+    // inputs
+    dut->clk(clk);
+    dut->nrst(nrst);
+    dut->console_tx_ready(console_tx_ready);
+    dut->instruction_dat_r(instruction_dat_r);
+    dut->instruction_ack(instruction_ack);
+    dut->instruction_err(instruction_err);
+    dut->data_dat_r(data_dat_r);
+    dut->data_ack(data_ack);
+    dut->data_err(data_err);
+
+    // outputs
+    dut->instruction_cyc(instruction_cyc);
+    dut->instruction_stb(instruction_stb);
+    dut->instruction_we(instruction_we);
+    dut->instruction_adr(instruction_adr);
+    dut->instruction_sel(instruction_sel);
+    dut->instruction_dat_w(instruction_dat_w);
+    dut->data_cyc(data_cyc);
+    dut->data_stb(data_stb);
+    dut->data_we(data_we);
+    dut->data_adr(data_adr);
+    dut->data_sel(data_sel);
+    dut->data_dat_w(data_dat_w);
+    dut->valid_wb(valid_wb);
+    dut->pc_wb(pc_wb);
+    dut->idle(idle);
+    dut->tohost(tohost);
+    dut->tohost_data(tohost_data);
+    dut->console_tx(console_tx);
+    dut->console_tx_data(console_tx_data);
+    dut->cycle_count(cycle_count);
+    dut->instret(instret);
+    dut->bus_error(bus_error);
+
+    nrst = 1;
+    console_tx_ready = 1;
+
+    sc_start(SC_ZERO_TIME);
+    Verilated::mkdir("logs");
+    tfp = new VerilatedFstSc;
+    dut->trace(tfp, 99);
+    tfp->open("logs/mips_r2000_wishbone_tb.fst");
+    std::signal(SIGABRT, [](int signal) { if(tfp) { tfp->flush(); tfp->close(); }});
+
+    Console console {};
+    const auto& run = [&](const std::vector<uint8_t>& image, const WishboneSlaveModel::Config& config) {
+        WishboneSlaveModel instruction_slave { ROM_SIZE, config };
+        instruction_slave.load(image);
+        WishboneSlaveModel data_slave { RAM_SIZE, config };
+        instruction_ack = false;
+        instruction_err = false;
+        data_ack = false;
+        data_err = false;
+        sc_start(1, SC_NS);
+        nrst = 0;
+        sc_start(1, SC_NS);
+        nrst = 1;
+        sc_start(1, SC_NS);
+
+        while(dut->tohost.read() == false) {
+            sc_start(5, SC_NS);
+            if(dut->console_tx.read()) {
+                console << static_cast<char>(dut->console_tx_data.read().to_uint());
+            }
+
+            const auto instruction_response = instruction_slave.drive();
+            instruction_dat_r = instruction_response.dat_r;
+            instruction_ack = instruction_response.ack;
+            instruction_err = instruction_response.err;
+            instruction_slave.commit(instruction_response, WishboneSlaveModel::Request {
+                .cyc = dut->instruction_cyc.read(),
+                .stb = dut->instruction_stb.read(),
+                .we = dut->instruction_we.read(),
+                .adr = dut->instruction_adr.read().to_uint(),
+                .sel = dut->instruction_sel.read().to_uint(),
+                .dat_w = dut->instruction_dat_w.read().to_uint()
+            });
+            // instruction fetches never write
+            assert(!dut->instruction_we.read());
+
+            const auto data_response = data_slave.drive();
+            data_dat_r = data_response.dat_r;
+            data_ack = data_response.ack;
+            data_err = data_response.err;
+            data_slave.commit(data_response, WishboneSlaveModel::Request {
+                .cyc = dut->data_cyc.read(),
+                .stb = dut->data_stb.read(),
+                .we = dut->data_we.read(),
+                .adr = dut->data_adr.read().to_uint(),
+                .sel = dut->data_sel.read().to_uint(),
+                .dat_w = dut->data_dat_w.read().to_uint()
+            });
+            sc_start(5, SC_NS);
+        }
+        console.flush();
+
+        const auto cycle_count = dut->cycle_count.read().to_uint();
+        const auto instret = dut->instret.read().to_uint();
+        std::printf(
+            "latency: %u..%u cycle_count: %u instret: %u CPI: %f instruction_reads: %lu data_reads: %lu data_writes: %lu\n",
+            config.min_latency,
+            config.max_latency,
+            cycle_count,
+            instret,
+            static_cast<double>(cycle_count) / instret,
+            instruction_slave.reads,
+            data_slave.reads,
+            data_slave.writes
+        );
+        return std::tuple { cycle_count, instret, instruction_slave, data_slave };
+    };
+
+    const std::array<WishboneSlaveModel::Config, 4> CONFIGS {
+        WishboneSlaveModel::Config { .min_latency = 1, .max_latency = 1, .seed = 0 },
+        WishboneSlaveModel::Config { .min_latency = 4, .max_latency = 4, .seed = 0 },
+        WishboneSlaveModel::Config { .min_latency = 1, .max_latency = 8, .seed = 1 },
+        WishboneSlaveModel::Config { .min_latency = 2, .max_latency = 20, .seed = 2 },
+    };
+
+    // without a line buffer every retired instruction was fetched on its own
+    // cycle
+    for(const auto& config: CONFIGS) {
+        console.output.clear();
+        const auto [cycle_count, instret, instruction_slave, data_slave] = run(BUBBLE_SORT_ROM, config);
+        assert(console.output == "251F73A0\n012357AF\n");
+        assert(dut->tohost_data.read().to_uint() == 0);
+        assert(instruction_slave.reads >= instret);
+        assert(dut->bus_error.read() == false);
+    }
+
+    for(const auto& config: CONFIGS) {
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(ALU_ROM, config);
+        const std::array<uint32_t, 4> RESULTS { 5050, 100, 10100, 5350 };
+        for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+            assert(data_slave.word(i * 4) == data);
+        }
+    }
+
+    // sub-word accesses keep the byte lanes of data_memory, the byte at
+    // address + 3 and the half word at address + 2
+    for(const auto& config: CONFIGS) {
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(LANE_ROM, config);
+        const std::array<uint32_t, 5> RESULTS { 0x1234'5678, 0x0000'00ab, 0x0000'fffe, 0x0000'579b, 0xffff'fffe };
+        for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+            assert(data_slave.word(i * 4) == data);
+        }
+    }
+
+    // the master keeps dat_r of the last cycle, the core id, thread id and
+    // console ready loads that follow a RAM load still read alone
+    for(const auto& config: CONFIGS) {
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(MMIO_ROM, config);
+        const std::array<uint32_t, 5> RESULTS { 0x1234'5678, 0x1234'5678, 0x0000'0000, 0x0000'0000, 0x0000'0001 };
+        for(const auto& [i, data]: std::views::enumerate(RESULTS)) {
+            assert(data_slave.word(i * 4) == data);
+        }
+    }
+
+    // err responses are flagged on bus_error and stay flagged, the program
+    // itself still runs to the end
+    {
+        auto config = CONFIGS[1];
+        config.err = true;
+        auto [cycle_count, instret, instruction_slave, data_slave] = run(ALU_ROM, config);
+        assert(data_slave.word(0) == 5050);
+        assert(dut->bus_error.read() == true);
+    }
+
+    const int exit_code = dut->tohost_data.read().to_int();
+    if(tfp) { tfp->flush(); tfp->close(); }
+    dut->final();
+    return exit_code;
+}
\ No newline at end of file
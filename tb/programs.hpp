@@ -0,0 +1,1525 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// misc/bubble_sort_demo from before HW_INIT and its .data and .bss, same
+// image as tb/mips_r2000.cpp
+inline const std::vector<uint8_t> BUBBLE_SORT_ROM {
+    0x3c,
+    0x1d,
+    0x80,
+    0x00,
+    0x27,
+    0xbd,
+    0x00,
+    0x80,
+    0x3c,
+    0x08,
+    0x80,
+    0x00,
+    0x25,
+    0x08,
+    0x00,
+    0x00,
+    0x3c,
+    0x09,
+    0x80,
+    0x00,
+    0x25,
+    0x29,
+    0x00,
+    0x00,
+    0x01,
+    0x09,
+    0x08,
+    0x2a,
+    0x10,
+    0x20,
+    0x00,
+    0x05,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xad,
+    0x00,
+    0x00,
+    0x00,
+    0x25,
+    0x08,
+    0x00,
+    0x04,
+    0x08,
+    0x00,
+    0x00,
+    0x06,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3c,
+    0x08,
+    0x80,
+    0x00,
+    0x25,
+    0x08,
+    0x04,
+    0x00,
+    0x3c,
+    0x09,
+    0x80,
+    0x00,
+    0x25,
+    0x29,
+    0x00,
+    0x00,
+    0x3c,
+    0x0a,
+    0x80,
+    0x00,
+    0x25,
+    0x4a,
+    0x00,
+    0x00,
+    0x01,
+    0x2a,
+    0x08,
+    0x2a,
+    0x10,
+    0x20,
+    0x00,
+    0x0a,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8d,
+    0x0b,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xad,
+    0x2b,
+    0x00,
+    0x00,
+    0x25,
+    0x08,
+    0x00,
+    0x04,
+    0x25,
+    0x29,
+    0x00,
+    0x04,
+    0x08,
+    0x00,
+    0x00,
+    0x13,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x0c,
+    0x00,
+    0x00,
+    0xfd,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xac,
+    0x02,
+    0xff,
+    0xf0,
+    0x10,
+    0x00,
+    0xff,
+    0xff,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x27,
+    0xbd,
+    0xff,
+    0xf0,
+    0xaf,
+    0xbe,
+    0x00,
+    0x0c,
+    0x03,
+    0xa0,
+    0xf0,
+    0x25,
+    0xaf,
+    0xc4,
+    0x00,
+    0x10,
+    0xaf,
+    0xc5,
+    0x00,
+    0x14,
+    0xaf,
+    0xc0,
+    0x00,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x1b,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc3,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x21,
+    0x8c,
+    0x43,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x01,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc4,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x10,
+    0x21,
+    0x8c,
+    0x42,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x43,
+    0x10,
+    0x2b,
+    0x10,
+    0x40,
+    0x00,
+    0x04,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x25,
+    0x10,
+    0x00,
+    0x00,
+    0x0e,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x01,
+    0xaf,
+    0xc2,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x14,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0xff,
+    0xff,
+    0x8f,
+    0xc3,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x2b,
+    0x14,
+    0x40,
+    0xff,
+    0xdf,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x02,
+    0x00,
+    0x01,
+    0x03,
+    0xc0,
+    0xe8,
+    0x25,
+    0x8f,
+    0xbe,
+    0x00,
+    0x0c,
+    0x27,
+    0xbd,
+    0x00,
+    0x10,
+    0x03,
+    0xe0,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x27,
+    0xbd,
+    0xff,
+    0xe0,
+    0xaf,
+    0xbf,
+    0x00,
+    0x1c,
+    0xaf,
+    0xbe,
+    0x00,
+    0x18,
+    0x03,
+    0xa0,
+    0xf0,
+    0x25,
+    0xaf,
+    0xc4,
+    0x00,
+    0x20,
+    0xaf,
+    0xc5,
+    0x00,
+    0x24,
+    0x10,
+    0x00,
+    0x00,
+    0x46,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xaf,
+    0xc0,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x3b,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc3,
+    0x00,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x21,
+    0x8c,
+    0x43,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x01,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc4,
+    0x00,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x10,
+    0x21,
+    0x8c,
+    0x42,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x43,
+    0x10,
+    0x2b,
+    0x10,
+    0x40,
+    0x00,
+    0x24,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc3,
+    0x00,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x21,
+    0x8c,
+    0x42,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xaf,
+    0xc2,
+    0x00,
+    0x14,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x01,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc3,
+    0x00,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x18,
+    0x21,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc4,
+    0x00,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x10,
+    0x21,
+    0x8c,
+    0x63,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xac,
+    0x43,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x01,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc3,
+    0x00,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x21,
+    0x8f,
+    0xc3,
+    0x00,
+    0x14,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xac,
+    0x43,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x01,
+    0xaf,
+    0xc2,
+    0x00,
+    0x10,
+    0x8f,
+    0xc2,
+    0x00,
+    0x24,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0xff,
+    0xff,
+    0x8f,
+    0xc3,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x2b,
+    0x14,
+    0x40,
+    0xff,
+    0xbf,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc5,
+    0x00,
+    0x24,
+    0x8f,
+    0xc4,
+    0x00,
+    0x20,
+    0x0c,
+    0x00,
+    0x00,
+    0x25,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x42,
+    0x00,
+    0x01,
+    0x30,
+    0x42,
+    0x00,
+    0xff,
+    0x14,
+    0x40,
+    0xff,
+    0xb4,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x03,
+    0xc0,
+    0xe8,
+    0x25,
+    0x8f,
+    0xbf,
+    0x00,
+    0x1c,
+    0x8f,
+    0xbe,
+    0x00,
+    0x18,
+    0x27,
+    0xbd,
+    0x00,
+    0x20,
+    0x03,
+    0xe0,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x27,
+    0xbd,
+    0xff,
+    0xf8,
+    0xaf,
+    0xbe,
+    0x00,
+    0x04,
+    0x03,
+    0xa0,
+    0xf0,
+    0x25,
+    0xaf,
+    0xc4,
+    0x00,
+    0x08,
+    0x3c,
+    0x02,
+    0xff,
+    0xff,
+    0x34,
+    0x42,
+    0x00,
+    0x08,
+    0x8c,
+    0x42,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x30,
+    0x42,
+    0x00,
+    0x01,
+    0x10,
+    0x40,
+    0xff,
+    0xfa,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3c,
+    0x02,
+    0xff,
+    0xff,
+    0x34,
+    0x42,
+    0x00,
+    0x0c,
+    0x8f,
+    0xc3,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xac,
+    0x43,
+    0x00,
+    0x00,
+    0x03,
+    0xc0,
+    0xe8,
+    0x25,
+    0x8f,
+    0xbe,
+    0x00,
+    0x04,
+    0x27,
+    0xbd,
+    0x00,
+    0x08,
+    0x03,
+    0xe0,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x27,
+    0xbd,
+    0xff,
+    0xd8,
+    0xaf,
+    0xbf,
+    0x00,
+    0x24,
+    0xaf,
+    0xbe,
+    0x00,
+    0x20,
+    0x03,
+    0xa0,
+    0xf0,
+    0x25,
+    0xaf,
+    0xc4,
+    0x00,
+    0x28,
+    0xaf,
+    0xc5,
+    0x00,
+    0x2c,
+    0xaf,
+    0xc0,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x1f,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x10,
+    0x80,
+    0x8f,
+    0xc3,
+    0x00,
+    0x28,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x21,
+    0x8c,
+    0x42,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x30,
+    0x42,
+    0x00,
+    0x0f,
+    0xaf,
+    0xc2,
+    0x00,
+    0x14,
+    0x8f,
+    0xc2,
+    0x00,
+    0x14,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x2c,
+    0x42,
+    0x00,
+    0x0a,
+    0x10,
+    0x40,
+    0x00,
+    0x06,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x14,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x30,
+    0x10,
+    0x00,
+    0x00,
+    0x04,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x14,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x37,
+    0x00,
+    0x40,
+    0x20,
+    0x25,
+    0x0c,
+    0x00,
+    0x00,
+    0xb2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x8f,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x42,
+    0x00,
+    0x01,
+    0xaf,
+    0xc2,
+    0x00,
+    0x10,
+    0x8f,
+    0xc3,
+    0x00,
+    0x10,
+    0x8f,
+    0xc2,
+    0x00,
+    0x2c,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x62,
+    0x10,
+    0x2b,
+    0x14,
+    0x40,
+    0xff,
+    0xdd,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x04,
+    0x00,
+    0x0a,
+    0x0c,
+    0x00,
+    0x00,
+    0xb2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x03,
+    0xc0,
+    0xe8,
+    0x25,
+    0x8f,
+    0xbf,
+    0x00,
+    0x24,
+    0x8f,
+    0xbe,
+    0x00,
+    0x20,
+    0x27,
+    0xbd,
+    0x00,
+    0x28,
+    0x03,
+    0xe0,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x27,
+    0xbd,
+    0xff,
+    0xc8,
+    0xaf,
+    0xbf,
+    0x00,
+    0x34,
+    0xaf,
+    0xbe,
+    0x00,
+    0x30,
+    0x03,
+    0xa0,
+    0xf0,
+    0x25,
+    0x24,
+    0x02,
+    0x00,
+    0x02,
+    0xaf,
+    0xc2,
+    0x00,
+    0x10,
+    0x24,
+    0x02,
+    0x00,
+    0x05,
+    0xaf,
+    0xc2,
+    0x00,
+    0x14,
+    0x24,
+    0x02,
+    0x00,
+    0x01,
+    0xaf,
+    0xc2,
+    0x00,
+    0x18,
+    0x24,
+    0x02,
+    0x00,
+    0x0f,
+    0xaf,
+    0xc2,
+    0x00,
+    0x1c,
+    0x24,
+    0x02,
+    0x00,
+    0x07,
+    0xaf,
+    0xc2,
+    0x00,
+    0x20,
+    0x24,
+    0x02,
+    0x00,
+    0x03,
+    0xaf,
+    0xc2,
+    0x00,
+    0x24,
+    0x24,
+    0x02,
+    0x00,
+    0x0a,
+    0xaf,
+    0xc2,
+    0x00,
+    0x28,
+    0xaf,
+    0xc0,
+    0x00,
+    0x2c,
+    0x24,
+    0x05,
+    0x00,
+    0x08,
+    0x27,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x40,
+    0x20,
+    0x25,
+    0x0c,
+    0x00,
+    0x00,
+    0xc7,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x05,
+    0x00,
+    0x08,
+    0x27,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x40,
+    0x20,
+    0x25,
+    0x0c,
+    0x00,
+    0x00,
+    0x55,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x05,
+    0x00,
+    0x08,
+    0x27,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x40,
+    0x20,
+    0x25,
+    0x0c,
+    0x00,
+    0x00,
+    0xc7,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x24,
+    0x05,
+    0x00,
+    0x08,
+    0x27,
+    0xc2,
+    0x00,
+    0x10,
+    0x00,
+    0x40,
+    0x20,
+    0x25,
+    0x0c,
+    0x00,
+    0x00,
+    0x25,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x42,
+    0x00,
+    0x01,
+    0x30,
+    0x42,
+    0x00,
+    0xff,
+    0x03,
+    0xc0,
+    0xe8,
+    0x25,
+    0x8f,
+    0xbf,
+    0x00,
+    0x34,
+    0x8f,
+    0xbe,
+    0x00,
+    0x30,
+    0x27,
+    0xbd,
+    0x00,
+    0x38,
+    0x03,
+    0xe0,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+};
+
+// misc/mips_r2000_dual/alu_program.s
+inline const std::vector<uint8_t> ALU_ROM {
+    0x24,
+    0x08,
+    0x00,
+    0x64,
+    0x24,
+    0x02,
+    0x00,
+    0x00,
+    0x24,
+    0x03,
+    0x00,
+    0x00,
+    0x24,
+    0x09,
+    0x00,
+    0x00,
+    0x24,
+    0x0a,
+    0x00,
+    0x00,
+    0x00,
+    0x48,
+    0x10,
+    0x21,
+    0x00,
+    0x68,
+    0x18,
+    0x26,
+    0x00,
+    0x08,
+    0x58,
+    0x40,
+    0x25,
+    0x0c,
+    0x00,
+    0x03,
+    0x01,
+    0x2b,
+    0x48,
+    0x21,
+    0x01,
+    0x4c,
+    0x50,
+    0x21,
+    0x25,
+    0x08,
+    0xff,
+    0xff,
+    0x15,
+    0x00,
+    0xff,
+    0xf8,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xac,
+    0x02,
+    0x00,
+    0x00,
+    0xac,
+    0x03,
+    0x00,
+    0x04,
+    0xac,
+    0x09,
+    0x00,
+    0x08,
+    0xac,
+    0x0a,
+    0x00,
+    0x0c,
+    0xac,
+    0x00,
+    0xff,
+    0xf0,
+    0x10,
+    0x00,
+    0xff,
+    0xff,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+};
+
+// misc/mips_r2000_registered_redirect/jump_program.s
+inline const std::vector<uint8_t> JUMP_ROM {
+    0x24,
+    0x08,
+    0x00,
+    0x64,
+    0x24,
+    0x02,
+    0x00,
+    0x00,
+    0x11,
+    0x00,
+    0x00,
+    0x04,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x48,
+    0x10,
+    0x21,
+    0x10,
+    0x00,
+    0xff,
+    0xfc,
+    0x25,
+    0x08,
+    0xff,
+    0xff,
+    0xac,
+    0x02,
+    0x00,
+    0x00,
+    0x0c,
+    0x00,
+    0x00,
+    0x0c,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x03,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xac,
+    0x1f,
+    0x00,
+    0x04,
+    0xac,
+    0x00,
+    0xff,
+    0xf0,
+    0x10,
+    0x00,
+    0xff,
+    0xff,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+};
+
+// misc/mips_r2000_axi/lane_program.s
+inline const std::vector<uint8_t> LANE_ROM {
+    0x3c,
+    0x08,
+    0x12,
+    0x34,
+    0x35,
+    0x08,
+    0x56,
+    0x78,
+    0x24,
+    0x09,
+    0x00,
+    0xab,
+    0x24,
+    0x0a,
+    0xff,
+    0xfe,
+    0xac,
+    0x08,
+    0x00,
+    0x00,
+    0xa0,
+    0x09,
+    0x00,
+    0x04,
+    0xa4,
+    0x0a,
+    0x00,
+    0x08,
+    0x80,
+    0x0b,
+    0x00,
+    0x00,
+    0x84,
+    0x0c,
+    0x00,
+    0x08,
+    0x94,
+    0x0d,
+    0x00,
+    0x00,
+    0x90,
+    0x0e,
+    0x00,
+    0x04,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x01,
+    0x6d,
+    0x10,
+    0x21,
+    0x00,
+    0x4e,
+    0x10,
+    0x21,
+    0xac,
+    0x02,
+    0x00,
+    0x0c,
+    0xac,
+    0x0c,
+    0x00,
+    0x10,
+    0xac,
+    0x00,
+    0xff,
+    0xf0,
+    0x10,
+    0x00,
+    0xff,
+    0xff,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+};
+
+// misc/mips_r2000_axi/mmio_program.s
+inline const std::vector<uint8_t> MMIO_ROM {
+    0x3c,
+    0x08,
+    0x12,
+    0x34,
+    0x35,
+    0x08,
+    0x56,
+    0x78,
+    0xac,
+    0x08,
+    0x00,
+    0x00,
+    0x8c,
+    0x09,
+    0x00,
+    0x00,
+    0x8c,
+    0x0a,
+    0xff,
+    0xfc,
+    0x8c,
+    0x0b,
+    0x00,
+    0x00,
+    0x8c,
+    0x0c,
+    0xff,
+    0xf8,
+    0x8c,
+    0x0d,
+    0x00,
+    0x00,
+    0x3c,
+    0x0f,
+    0xff,
+    0xff,
+    0x8d,
+    0xee,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xac,
+    0x09,
+    0x00,
+    0x04,
+    0xac,
+    0x0a,
+    0x00,
+    0x08,
+    0xac,
+    0x0c,
+    0x00,
+    0x0c,
+    0xac,
+    0x0e,
+    0x00,
+    0x10,
+    0xac,
+    0x00,
+    0xff,
+    0xf0,
+    0x10,
+    0x00,
+    0xff,
+    0xff,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+};
@@ -1,10 +1,35 @@
 #pragma once
 
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <systemc>
+
 template<typename ... Args>
 auto cc(const Args& ... args) {
     return (args, ...);
 }
 
+struct Console {
+    static constexpr std::size_t BATCH_SIZE = 256;
+    std::string output {};
+    std::string pending {};
+
+    void operator<<(const char c) {
+        output.push_back(c);
+        pending.push_back(c);
+        if(c == '\n' || pending.size() >= BATCH_SIZE) {
+            flush();
+        }
+    }
+
+    void flush() {
+        std::fwrite(pending.data(), sizeof(char), pending.size(), stdout);
+        std::fflush(stdout);
+        pending.clear();
+    }
+};
+
 struct Constants {
     static constexpr int unsigned REG_COUNT = 32;
 };
@@ -38,6 +63,134 @@ struct Decode {
         ALUMode_SRL = 0b0'0110,
         ALUMode_SRA = 0b0'0111,
         ALUMode_SLT = 0b1'1010,
-        ALUMode_SLTU = 0b1'1011
+        ALUMode_SLTU = 0b1'1011,
+        ALUMode_CLZ = 0b0'1000,
+        ALUMode_CLO = 0b0'1001,
+        ALUMode_MOVZ = 0b0'1010,
+        ALUMode_MOVN = 0b0'1011
+    };
+
+    // Mirrors the select_encoder module, bit 0 is the last struct member.
+    static sc_dt::sc_bv<17> alu_select(
+        const bool alu_mode,
+        const int unsigned alu_mode_value,
+        const bool link,
+        const bool lui,
+        const bool load,
+        const bool store
+    ) {
+        sc_dt::sc_bv<17> select { 0 };
+        if(load || store) {
+            select[16] = true;
+        } else if(alu_mode) {
+            select[16] = !link && (alu_mode_value == ALUMode_ADD || alu_mode_value == ALUMode_ADDU);
+            select[15] = alu_mode_value == ALUMode_SUB || alu_mode_value == ALUMode_SUBU;
+            select[14] = alu_mode_value == ALUMode_AND;
+            select[13] = alu_mode_value == ALUMode_OR;
+            select[12] = alu_mode_value == ALUMode_XOR;
+            select[11] = alu_mode_value == ALUMode_NOR;
+            select[10] = !lui && (alu_mode_value == ALUMode_SLL);
+            select[9] = alu_mode_value == ALUMode_SRL;
+            select[8] = alu_mode_value == ALUMode_SRA;
+            select[7] = alu_mode_value == ALUMode_SLT;
+            select[6] = alu_mode_value == ALUMode_SLTU;
+            select[5] = alu_mode_value == ALUMode_CLZ;
+            select[4] = alu_mode_value == ALUMode_CLO;
+            select[3] = alu_mode_value == ALUMode_MOVZ;
+            select[2] = alu_mode_value == ALUMode_MOVN;
+            select[1] = link && (alu_mode_value == ALUMode_ADDU);
+            select[0] = lui && (alu_mode_value == ALUMode_SLL);
+        }
+        return select;
+    }
+
+    static sc_dt::sc_bv<6> branch_select(const bool branch, const int unsigned branch_mode) {
+        sc_dt::sc_bv<6> select { 0 };
+        if(branch) {
+            select[5] = branch_mode == BranchMode_BLTZ;
+            select[4] = branch_mode == BranchMode_BGEZ;
+            select[3] = branch_mode == BranchMode_BEQ;
+            select[2] = branch_mode == BranchMode_BNE;
+            select[1] = branch_mode == BranchMode_BLEZ;
+            select[0] = branch_mode == BranchMode_BGTZ;
+        }
+        return select;
+    }
+
+    static bool trap(const bool alu_mode, const int unsigned alu_mode_value, const bool link) {
+        return alu_mode && !link && (alu_mode_value == ALUMode_ADD || alu_mode_value == ALUMode_SUB);
+    }
+
+    // Unpacks the Decode::Control port, the fields are taken from bit 0 up so
+    // they come in the reverse of their declaration order.
+    struct Control {
+        static constexpr int unsigned WIDTH = 127;
+
+        bool rs { false };
+        sc_dt::sc_bv<5> rs_address { 0 };
+        bool rt { false };
+        sc_dt::sc_bv<5> rt_address { 0 };
+        bool rd { false };
+        sc_dt::sc_bv<5> rd_address { 0 };
+        bool shamt { false };
+        sc_dt::sc_bv<5> shamt_value { 0 };
+        bool imm { false };
+        sc_dt::sc_bv<16> imm_value { 0 };
+        bool target { false };
+        sc_dt::sc_bv<26> target_value { 0 };
+        bool alu_mode { false };
+        bool link { false };
+        bool branch { false };
+        bool jump { false };
+        bool load { false };
+        bool load_sign_extend { false };
+        sc_dt::sc_bv<2> load_store_data_size_mode { 0 };
+        bool store { false };
+        bool load_linked { false };
+        bool store_conditional { false };
+        bool trap { false };
+        sc_dt::sc_bv<17> alu_select { 0 };
+        sc_dt::sc_bv<6> branch_select { 0 };
+        sc_dt::sc_bv<11> cop0_select { 0 };
+        sc_dt::sc_bv<8> mac_select { 0 };
+        sc_dt::sc_bv<5> custom_select { 0 };
+
+        explicit Control(const sc_dt::sc_bv<WIDTH>& bits) {
+            int unsigned lsb = 0;
+            const auto take = [&](const int unsigned width) {
+                const sc_dt::sc_bv<32> field = bits.range(lsb + width - 1, lsb);
+                lsb += width;
+                return field;
+            };
+            custom_select = take(5);
+            mac_select = take(8);
+            cop0_select = take(11);
+            branch_select = take(6);
+            alu_select = take(17);
+            trap = take(1).to_uint();
+            store_conditional = take(1).to_uint();
+            load_linked = take(1).to_uint();
+            store = take(1).to_uint();
+            load_store_data_size_mode = take(2);
+            load_sign_extend = take(1).to_uint();
+            load = take(1).to_uint();
+            jump = take(1).to_uint();
+            branch = take(1).to_uint();
+            link = take(1).to_uint();
+            alu_mode = take(1).to_uint();
+            target_value = take(26);
+            target = take(1).to_uint();
+            imm_value = take(16);
+            imm = take(1).to_uint();
+            shamt_value = take(5);
+            shamt = take(1).to_uint();
+            rd_address = take(5);
+            rd = take(1).to_uint();
+            rt_address = take(5);
+            rt = take(1).to_uint();
+            rs_address = take(5);
+            rs = take(1).to_uint();
+            assert(lsb == WIDTH);
+        }
     };
 };
\ No newline at end of file
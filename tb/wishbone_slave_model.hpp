@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+// Cycle based model of a Wishbone B4 classic slave in front of a memory. A
+// cycle is answered with ack (or err) after a latency drawn from
+// [min_latency, max_latency], the earliest the cycle after cyc and stb went
+// up. Lane i of the data bus carries the byte at adr + i, writes only touch
+// the bytes in sel. Addresses wrap at the size, which has to be a power of
+// two. With err every cycle ends in err, the data is still transferred.
+struct WishboneSlaveModel {
+    struct Config {
+        uint32_t min_latency { 1 };
+        uint32_t max_latency { 1 };
+        uint32_t seed { 0 };
+        bool err { false };
+    };
+
+    struct Response {
+        uint32_t dat_r { 0 };
+        bool ack { false };
+        bool err { false };
+    };
+
+    struct Request {
+        bool cyc { false };
+        bool stb { false };
+        bool we { false };
+        uint32_t adr { 0 };
+        uint32_t sel { 0 };
+        uint32_t dat_w { 0 };
+    };
+
+    struct Access {
+        uint64_t due;
+        uint32_t address;
+    };
+
+    std::vector<uint8_t> bytes;
+    Config config;
+    std::mt19937 rng;
+    std::optional<Access> access {};
+    uint64_t cycle { 0 };
+    uint64_t reads { 0 };
+    uint64_t writes { 0 };
+
+    WishboneSlaveModel(const std::size_t size, const Config& config):
+        bytes(size, 0),
+        config { config },
+        rng { config.seed }
+    {}
+
+    void load(const std::vector<uint8_t>& image) {
+        std::fill(bytes.begin(), bytes.end(), 0);
+        std::copy_n(image.begin(), std::min(image.size(), bytes.size()), bytes.begin());
+    }
+
+    uint8_t& at(const uint32_t address) {
+        return bytes[address & (bytes.size() - 1)];
+    }
+
+    // Big endian word at an aligned address, the way the core sees memory.
+    uint32_t word(const uint32_t address) {
+        return (
+            (static_cast<uint32_t>(at(address + 0)) << 24)
+            | (static_cast<uint32_t>(at(address + 1)) << 16)
+            | (static_cast<uint32_t>(at(address + 2)) << 8)
+            | static_cast<uint32_t>(at(address + 3))
+        );
+    }
+
+    // What the slave shows during the current cycle, it only depends on the
+    // state left by earlier cycles.
+    Response drive() {
+        Response ret {};
+        if(access && (access->due <= cycle)) {
+            const uint32_t aligned { access->address & ~uint32_t { 3 } };
+            ret.dat_r = (
+                static_cast<uint32_t>(at(aligned + 0))
+                | (static_cast<uint32_t>(at(aligned + 1)) << 8)
+                | (static_cast<uint32_t>(at(aligned + 2)) << 16)
+                | (static_cast<uint32_t>(at(aligned + 3)) << 24)
+            );
+            ret.ack = !config.err;
+            ret.err = config.err;
+        }
+        return ret;
+    }
+
+    // Takes what the master presents during the current cycle and advances to
+    // the next one.
+    void commit(const Response& response, const Request& request) {
+        if(response.ack || response.err) {
+            // the master holds the cycle until it sees the answer
+            assert(request.cyc && request.stb);
+            if(request.we) {
+                const uint32_t aligned { access->address & ~uint32_t { 3 } };
+                for(uint32_t i = 0; i < 4; i++) {
+                    if(request.sel & (1 << i)) {
+                        at(aligned + i) = request.dat_w >> (i * 8);
+                    }
+                }
+                writes++;
+            } else {
+                reads++;
+            }
+            access.reset();
+        } else if(request.cyc && request.stb && !access) {
+            access = Access { cycle + latency(), request.adr };
+        }
+        cycle++;
+    }
+
+private:
+    uint32_t latency() {
+        return std::max<uint32_t>(std::uniform_int_distribution<uint32_t> { config.min_latency, config.max_latency }(rng), 1);
+    }
+};
\ No newline at end of file